@@ -86,6 +86,16 @@
 
 #define  GLUT_SKIP_STALE_MOTION_EVENTS      0x0204
 
+#define  GLUT_BITMAP_FONT_ATLAS             0x0205
+#define  GLUT_STROKE_FONT_POINTS            0x0206
+
+#define  GLUT_MENU_MAX_ROWS                 0x0207
+
+/*
+ * GLUT API Extension macro definitions -- the glutDeviceGet parameters
+ */
+#define  GLUT_JOYSTICK_EVENTS_COALESCED     0x0269
+
 /*
  * New tokens for glutInitDisplayMode.
  * Only one GLUT_AUXn bit may be used at a time.
@@ -159,6 +169,19 @@ FGAPI int     FGAPIENTRY glutBitmapHeight( void* font );
 FGAPI GLfloat FGAPIENTRY glutStrokeHeight( void* font );
 FGAPI void    FGAPIENTRY glutBitmapString( void* font, const unsigned char *string );
 FGAPI void    FGAPIENTRY glutStrokeString( void* font, const unsigned char *string );
+FGAPI int     FGAPIENTRY glutBitmapLengthN( void* font, const unsigned char *string, int length );
+FGAPI int     FGAPIENTRY glutStrokeLengthN( void* font, const unsigned char *string, int length );
+FGAPI void    FGAPIENTRY glutBitmapBegin( void* font );
+FGAPI void    FGAPIENTRY glutBitmapEnd( void );
+FGAPI int     FGAPIENTRY glutCreateText( void* font, const unsigned char *string );
+FGAPI void    FGAPIENTRY glutUpdateText( int text, const unsigned char *string );
+FGAPI void    FGAPIENTRY glutDrawText( int text );
+FGAPI void    FGAPIENTRY glutGetTextBounds( int text, GLfloat* bounds );
+FGAPI void    FGAPIENTRY glutDestroyText( int text );
+FGAPI void*   FGAPIENTRY glutLoadBitmapFont( const char* path );
+FGAPI void    FGAPIENTRY glutTextPosition( GLfloat x, GLfloat y );
+FGAPI void    FGAPIENTRY glutTextColor( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha );
+FGAPI void    FGAPIENTRY glutTextOrtho( GLfloat left, GLfloat right, GLfloat bottom, GLfloat top );
 
 /*
  * Geometry functions, see freeglut_geometry.c
@@ -169,6 +192,30 @@ FGAPI void    FGAPIENTRY glutWireSierpinskiSponge ( int num_levels, GLdouble off
 FGAPI void    FGAPIENTRY glutSolidSierpinskiSponge ( int num_levels, GLdouble offset[3], GLdouble scale );
 FGAPI void    FGAPIENTRY glutWireCylinder( GLdouble radius, GLdouble height, GLint slices, GLint stacks);
 FGAPI void    FGAPIENTRY glutSolidCylinder( GLdouble radius, GLdouble height, GLint slices, GLint stacks);
+FGAPI void    FGAPIENTRY glutWireSphereAuto( GLdouble radius, GLdouble pixelError );
+FGAPI void    FGAPIENTRY glutSolidSphereAuto( GLdouble radius, GLdouble pixelError );
+FGAPI void    FGAPIENTRY glutWireConeAuto( GLdouble base, GLdouble height, GLdouble pixelError );
+FGAPI void    FGAPIENTRY glutSolidConeAuto( GLdouble base, GLdouble height, GLdouble pixelError );
+FGAPI void    FGAPIENTRY glutWireCylinderAuto( GLdouble radius, GLdouble height, GLdouble pixelError );
+FGAPI void    FGAPIENTRY glutSolidCylinderAuto( GLdouble radius, GLdouble height, GLdouble pixelError );
+FGAPI void    FGAPIENTRY glutWireTorusAuto( GLdouble innerRadius, GLdouble outerRadius, GLdouble pixelError );
+FGAPI void    FGAPIENTRY glutSolidTorusAuto( GLdouble innerRadius, GLdouble outerRadius, GLdouble pixelError );
+FGAPI void    FGAPIENTRY glutWireCubef( GLfloat size );
+FGAPI void    FGAPIENTRY glutSolidCubef( GLfloat size );
+FGAPI void    FGAPIENTRY glutWireSpheref( GLfloat radius, GLint slices, GLint stacks );
+FGAPI void    FGAPIENTRY glutSolidSpheref( GLfloat radius, GLint slices, GLint stacks );
+FGAPI void    FGAPIENTRY glutWireConef( GLfloat base, GLfloat height, GLint slices, GLint stacks );
+FGAPI void    FGAPIENTRY glutSolidConef( GLfloat base, GLfloat height, GLint slices, GLint stacks );
+FGAPI void    FGAPIENTRY glutWireCylinderf( GLfloat radius, GLfloat height, GLint slices, GLint stacks );
+FGAPI void    FGAPIENTRY glutSolidCylinderf( GLfloat radius, GLfloat height, GLint slices, GLint stacks );
+FGAPI void    FGAPIENTRY glutWireTorusf( GLfloat innerRadius, GLfloat outerRadius, GLint sides, GLint rings );
+FGAPI void    FGAPIENTRY glutSolidTorusf( GLfloat innerRadius, GLfloat outerRadius, GLint sides, GLint rings );
+
+/*
+ * Teapot rendering functions, see freeglut_teapot.c
+ */
+FGAPI void    FGAPIENTRY glutWireTeapotLOD( GLdouble size, GLint grid );
+FGAPI void    FGAPIENTRY glutSolidTeapotLOD( GLdouble size, GLint grid );
 
 /*
  * Extension functions, see freeglut_ext.c
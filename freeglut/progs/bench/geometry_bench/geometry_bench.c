@@ -0,0 +1,399 @@
+/*! \file    geometry_bench.c
+    \ingroup bench
+
+    This program measures how fast the freeglut geometry routines
+    draw.  Every solid and wire shape, the teapot, the Sierpinski
+    sponge and the stroke fonts are drawn for a fixed number of
+    frames, sweeping the slices, stacks, grid and level parameters.
+
+    The results go to stdout as CSV, one line per configuration:
+      - the vertices one object sends down the pipeline, counted
+        in feedback mode, and the draw calls it takes
+      - the vertices drawn per second
+      - the 50th, 90th and 99th percentile frame times
+
+    The program needs a window but never shows anything worth
+    looking at, so it is best run without a display, e.g.
+    <tt>xvfb-run ./geometry_bench</tt> with Mesa.
+
+    Usage: <tt>geometry_bench [frames [objects_per_frame]]</tt>
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <GL/freeglut.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <dlfcn.h>
+
+#define NUMBEROF(x)  ((sizeof(x))/(sizeof(x[0])))
+
+static int frames = 100;
+static int objects = 16;
+
+/*
+ * Draw calls are counted by standing in front of the GL entry points
+ * freeglut uses; the program is linked with -export-dynamic so these
+ * win over the ones in the GL library, and forward to them.
+ */
+static long drawCalls = 0;
+
+#ifdef RTLD_NEXT
+
+#define FORWARD(name,params,args)                               \
+    void GLAPIENTRY name params                                 \
+    {                                                           \
+        static void (GLAPIENTRY *real) params = NULL;           \
+        if (!real)                                              \
+            *(void **)(&real) = dlsym(RTLD_NEXT, #name);        \
+        drawCalls++;                                            \
+        real args;                                              \
+    }
+
+FORWARD(glBegin, (GLenum mode), (mode))
+FORWARD(glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+FORWARD(glDrawElements, (GLenum mode, GLsizei count, GLenum type, const GLvoid *indices), (mode, count, type, indices))
+
+#undef FORWARD
+
+/*
+ * freeglut looks glMultiDrawArrays up at run time, so the stand-in is
+ * handed out from the lookup instead.
+ */
+typedef void (*ProcAddress)(void);
+typedef void (GLAPIENTRY *MultiDrawArraysProc)(GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount);
+static MultiDrawArraysProc realMultiDrawArrays = NULL;
+
+static void GLAPIENTRY countMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount)
+{
+    drawCalls++;
+    realMultiDrawArrays(mode, first, count, primcount);
+}
+
+ProcAddress glXGetProcAddressARB(const GLubyte *name)
+{
+    static ProcAddress (*real)(const GLubyte *) = NULL;
+    ProcAddress proc;
+
+    if (!real)
+        *(void **)(&real) = dlsym(RTLD_NEXT, "glXGetProcAddressARB");
+    proc = real(name);
+    if (proc && !strcmp((const char *)name, "glMultiDrawArrays"))
+    {
+        realMultiDrawArrays = (MultiDrawArraysProc)proc;
+        proc = (ProcAddress)countMultiDrawArrays;
+    }
+    return proc;
+}
+
+#endif
+
+/*
+ * The shapes to sweep. Each is drawn at about unit size, centred on the
+ * origin, with the two sweep parameters where it has them.
+ */
+static void drawSphere(int wire, int a, int b)
+{
+    if (wire) glutWireSphere(1.0, a, b); else glutSolidSphere(1.0, a, b);
+}
+static void drawCone(int wire, int a, int b)
+{
+    glTranslated(0.0, 0.0, -0.75);
+    if (wire) glutWireCone(1.0, 1.5, a, b); else glutSolidCone(1.0, 1.5, a, b);
+}
+static void drawCylinder(int wire, int a, int b)
+{
+    glTranslated(0.0, 0.0, -0.75);
+    if (wire) glutWireCylinder(1.0, 1.5, a, b); else glutSolidCylinder(1.0, 1.5, a, b);
+}
+static void drawTorus(int wire, int a, int b)
+{
+    if (wire) glutWireTorus(0.3, 1.0, a, b); else glutSolidTorus(0.3, 1.0, a, b);
+}
+static void drawCube(int wire, int a, int b)
+{
+    if (wire) glutWireCube(1.5); else glutSolidCube(1.5);
+}
+static void drawTetrahedron(int wire, int a, int b)
+{
+    if (wire) glutWireTetrahedron(); else glutSolidTetrahedron();
+}
+static void drawOctahedron(int wire, int a, int b)
+{
+    if (wire) glutWireOctahedron(); else glutSolidOctahedron();
+}
+static void drawDodecahedron(int wire, int a, int b)
+{
+    if (wire) glutWireDodecahedron(); else glutSolidDodecahedron();
+}
+static void drawIcosahedron(int wire, int a, int b)
+{
+    if (wire) glutWireIcosahedron(); else glutSolidIcosahedron();
+}
+static void drawRhombicDodecahedron(int wire, int a, int b)
+{
+    if (wire) glutWireRhombicDodecahedron(); else glutSolidRhombicDodecahedron();
+}
+static void drawTeapot(int wire, int a, int b)
+{
+    if (wire) glutWireTeapotLOD(0.8, a); else glutSolidTeapotLOD(0.8, a);
+}
+static void drawSierpinskiSponge(int wire, int a, int b)
+{
+    GLdouble offset[3] = { 0.0, 0.0, 0.0 };
+    if (wire) glutWireSierpinskiSponge(a, offset, 1.0); else glutSolidSierpinskiSponge(a, offset, 1.0);
+}
+
+static const unsigned char strokeText[] =
+    "The quick brown fox jumps over the lazy dog. 0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+
+static void drawStroke(void *font)
+{
+    /* Scale the line of text down to fit the view */
+    const GLdouble scale = 4.0 / glutStrokeLength(font, strokeText);
+
+    glTranslated(-2.0, 0.0, 0.0);
+    glScaled(scale, scale, scale);
+    glutStrokeString(font, strokeText);
+}
+static void drawStrokeRoman(int wire, int a, int b)
+{
+    drawStroke(GLUT_STROKE_ROMAN);
+}
+static void drawStrokeMonoRoman(int wire, int a, int b)
+{
+    drawStroke(GLUT_STROKE_MONO_ROMAN);
+}
+
+typedef void (*drawFunc)(int wire, int a, int b);
+
+typedef struct
+{
+    const char *name;
+    drawFunc    draw;
+    int         modes;      /* 2 for solid and wire, 1 for stroke text */
+    const char *params;     /* names of the swept parameters           */
+    int         steps;      /* number of parameter pairs in a and b    */
+    int         a[8], b[8];
+} Shape;
+
+static const Shape shapes[] =
+{
+    { "sphere",                drawSphere,               2, "slices/stacks", 6, { 8, 16, 32, 64, 128, 256 }, { 8, 16, 32, 64, 128, 256 } },
+    { "cone",                  drawCone,                 2, "slices/stacks", 6, { 8, 16, 32, 64, 128, 256 }, { 1, 4, 8, 16, 32, 64 } },
+    { "cylinder",              drawCylinder,             2, "slices/stacks", 6, { 8, 16, 32, 64, 128, 256 }, { 1, 4, 8, 16, 32, 64 } },
+    { "torus",                 drawTorus,                2, "sides/rings",   6, { 4, 8, 16, 32, 64, 128 }, { 8, 16, 32, 64, 128, 256 } },
+    { "cube",                  drawCube,                 2, "-",             1, { 0 }, { 0 } },
+    { "tetrahedron",           drawTetrahedron,          2, "-",             1, { 0 }, { 0 } },
+    { "octahedron",            drawOctahedron,           2, "-",             1, { 0 }, { 0 } },
+    { "dodecahedron",          drawDodecahedron,         2, "-",             1, { 0 }, { 0 } },
+    { "icosahedron",           drawIcosahedron,          2, "-",             1, { 0 }, { 0 } },
+    { "rhombic_dodecahedron",  drawRhombicDodecahedron,  2, "-",             1, { 0 }, { 0 } },
+    { "teapot",                drawTeapot,               2, "grid",          6, { 2, 4, 7, 10, 14, 20 }, { 0 } },
+    { "sierpinski_sponge",     drawSierpinskiSponge,     2, "levels",        8, { 0, 1, 2, 3, 4, 5, 6, 7 }, { 0 } },
+    { "stroke_roman",          drawStrokeRoman,          1, "-",             1, { 0 }, { 0 } },
+    { "stroke_mono_roman",     drawStrokeMonoRoman,      1, "-",             1, { 0 }, { 0 } }
+};
+
+static double now(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static int compareDoubles(const void *a, const void *b)
+{
+    const double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void drawObject(const Shape *shape, int wire, int step)
+{
+    glPushMatrix();
+    shape->draw(wire, shape->a[step], shape->b[step]);
+    glPopMatrix();
+}
+
+/*
+ * Counts the vertices one object sends down the pipeline, by drawing it
+ * in feedback mode, and the draw calls it takes while doing so.
+ */
+static long countVertices(const Shape *shape, int wire, int step, long *calls)
+{
+    static GLfloat *buffer = NULL;
+    static GLsizei size = 1 << 16;
+    GLint used, i;
+    long vertices = 0;
+
+    for (;;)
+    {
+        if (!buffer)
+            buffer = (GLfloat *)malloc(size * sizeof(GLfloat));
+        if (!buffer)
+        {
+            fprintf(stderr, "geometry_bench: out of memory\n");
+            exit(1);
+        }
+
+        glFeedbackBuffer(size, GL_2D, buffer);
+        glRenderMode(GL_FEEDBACK);
+        drawCalls = 0;
+        drawObject(shape, wire, step);
+        *calls = drawCalls;
+        used = glRenderMode(GL_RENDER);
+
+        if (used >= 0)
+            break;
+
+        /* The buffer overflowed, try again with a bigger one */
+        free(buffer);
+        buffer = NULL;
+        size *= 2;
+    }
+
+    for (i = 0; i < used; )
+    {
+        const GLint token = (GLint)buffer[i++];
+
+        switch (token)
+        {
+        case GL_POLYGON_TOKEN:
+        {
+            const GLint n = (GLint)buffer[i++];
+            vertices += n;
+            i += 2 * n;
+            break;
+        }
+        case GL_LINE_TOKEN:
+        case GL_LINE_RESET_TOKEN:
+            vertices += 2;
+            i += 4;
+            break;
+        case GL_POINT_TOKEN:
+        case GL_BITMAP_TOKEN:
+        case GL_DRAW_PIXEL_TOKEN:
+        case GL_COPY_PIXEL_TOKEN:
+            vertices += 1;
+            i += 2;
+            break;
+        case GL_PASS_THROUGH_TOKEN:
+            i += 1;
+            break;
+        default:
+            fprintf(stderr, "geometry_bench: unexpected feedback token %d\n", token);
+            return vertices;
+        }
+    }
+
+    return vertices;
+}
+
+static void benchmark(const Shape *shape, int wire, int step, double *times)
+{
+    long vertices, calls;
+    double total = 0.0;
+    int f, k;
+
+    vertices = countVertices(shape, wire, step, &calls);
+
+    /* One untimed frame, to build any caches */
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    drawObject(shape, wire, step);
+    glFinish();
+
+    for (f = 0; f < frames; f++)
+    {
+        const double start = now();
+
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        for (k = 0; k < objects; k++)
+            drawObject(shape, wire, step);
+        glFinish();
+
+        times[f] = now() - start;
+        total += times[f];
+    }
+
+    qsort(times, frames, sizeof(double), compareDoubles);
+
+    printf("%s,%s,%s,", shape->name, (shape->modes == 1) ? "stroke" : (wire ? "wire" : "solid"), shape->params);
+    if (!strcmp(shape->params, "-"))
+        printf("-,");
+    else if (strchr(shape->params, '/'))
+        printf("%d/%d,", shape->a[step], shape->b[step]);
+    else
+        printf("%d,", shape->a[step]);
+    printf("%ld,%ld,%.0f,%.3f,%.3f,%.3f\n",
+           vertices, calls * objects,
+           (total > 0.0) ? (double)vertices * objects * frames / total : 0.0,
+           times[frames / 2] * 1000.0,
+           times[(frames * 9) / 10] * 1000.0,
+           times[(frames * 99) / 100] * 1000.0);
+    fflush(stdout);
+}
+
+static void display(void)
+{
+}
+
+int main(int argc, char *argv[])
+{
+    const GLfloat lightPosition[] = { 2.0f, 5.0f, 5.0f, 0.0f };
+    double *times;
+    unsigned int s;
+    int i, step, wire;
+
+    glutInitWindowSize(256, 256);
+    glutInit(&argc, argv);
+    glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE | GLUT_DEPTH);
+
+    if (argc > 1) frames = atoi(argv[1]);
+    if (argc > 2) objects = atoi(argv[2]);
+    if (frames < 1) frames = 1;
+    if (objects < 1) objects = 1;
+
+    glutCreateWindow("freeglut geometry benchmark");
+    glutDisplayFunc(display);
+
+    /* Let the window get mapped before timing anything */
+    for (i = 0; i < 10; i++)
+        glutMainLoopEvent();
+
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(-3.0, 3.0, -3.0, 3.0, -10.0, 10.0);
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    glRotated(30.0, 1.0, 0.0, 0.0);
+
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_LIGHTING);
+    glEnable(GL_LIGHT0);
+    glLightfv(GL_LIGHT0, GL_POSITION, lightPosition);
+
+    times = (double *)malloc(frames * sizeof(double));
+    if (!times)
+    {
+        fprintf(stderr, "geometry_bench: out of memory\n");
+        return 1;
+    }
+
+    printf("# renderer: %s, %s\n", (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION));
+    printf("# %d frames of %d objects per configuration\n", frames, objects);
+    printf("shape,mode,params,values,vertices,draw_calls_per_frame,vertices_per_second,frame_ms_p50,frame_ms_p90,frame_ms_p99\n");
+
+    for (s = 0; s < NUMBEROF(shapes); s++)
+        for (wire = 0; wire < shapes[s].modes; wire++)
+            for (step = 0; step < shapes[s].steps; step++)
+                benchmark(&shapes[s], wire, step, times);
+
+    free(times);
+
+    return 0;
+}
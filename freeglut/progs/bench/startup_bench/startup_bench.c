@@ -0,0 +1,213 @@
+/*! \file    startup_bench.c
+    \ingroup bench
+
+    This program measures what loading the freeglut shared library
+    costs a process: the dynamic relocations the loader applies to
+    it, the time dlopen() takes, and how much of the library ends up
+    resident and privately dirtied.  Every pointer in the library's
+    initialised data needs a relocation, and every page holding one
+    becomes a private copy in each process using the library.
+
+    Each run loads the library in a fresh child process.  The results
+    go to stdout as CSV, one line:
+      - the relocations in the library, how many of them are relative
+        (pointers into the library itself) and the PLT relocations
+      - the median and 90th percentile dlopen() times in microseconds,
+        which include loading the libraries freeglut depends on
+      - the resident and private dirty memory of the library's own
+        mappings, in kB
+
+    The program needs no display, as freeglut is never initialised.
+    It is specific to Linux and other ELF systems using glibc.
+
+    Usage: <tt>startup_bench [library [runs]]</tt>
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include <link.h>
+
+#ifndef LIBRARY_PATH
+#define LIBRARY_PATH "libglut.so.3"
+#endif
+
+typedef struct
+{
+    long relocations, relative, plt;
+    double microseconds;
+    long rss, privateDirty;
+} Sample;
+
+/*
+ * Counts the relocations listed in the library's dynamic section
+ */
+static void countRelocations(struct link_map *map, Sample *sample)
+{
+    ElfW(Dyn) *dyn;
+    long relaSize = 0, relaEntry = 0, relSize = 0, relEntry = 0;
+    long pltSize = 0, pltType = DT_RELA;
+
+    for (dyn = map->l_ld; dyn->d_tag != DT_NULL; dyn++)
+        switch (dyn->d_tag)
+        {
+        case DT_RELASZ:   relaSize = dyn->d_un.d_val; break;
+        case DT_RELAENT:  relaEntry = dyn->d_un.d_val; break;
+        case DT_RELSZ:    relSize = dyn->d_un.d_val; break;
+        case DT_RELENT:   relEntry = dyn->d_un.d_val; break;
+        case DT_PLTRELSZ: pltSize = dyn->d_un.d_val; break;
+        case DT_PLTREL:   pltType = dyn->d_un.d_val; break;
+        case DT_RELACOUNT:
+        case DT_RELCOUNT: sample->relative += dyn->d_un.d_val; break;
+        }
+
+    if (relaEntry)
+        sample->relocations += relaSize / relaEntry;
+    if (relEntry)
+        sample->relocations += relSize / relEntry;
+    if (pltType == DT_RELA && relaEntry)
+        sample->plt = pltSize / relaEntry;
+    else if (relEntry)
+        sample->plt = pltSize / relEntry;
+}
+
+/*
+ * Adds up the Rss and Private_Dirty lines of the mappings of the file
+ */
+static void measureMemory(const char *path, Sample *sample)
+{
+    FILE *smaps = fopen("/proc/self/smaps", "r");
+    char line[PATH_MAX + 128];
+    int inLibrary = 0;
+    unsigned long low, high;
+    long kB;
+
+    if (!smaps)
+        return;
+
+    while (fgets(line, sizeof(line), smaps))
+    {
+        char *name;
+
+        /* Mapping headers start with the address range, "lo-hi perms" */
+        if (sscanf(line, "%lx-%lx ", &low, &high) == 2)
+        {
+            line[strcspn(line, "\n")] = '\0';
+            name = strchr(line, '/');
+            inLibrary = name && !strcmp(name, path);
+        }
+        else if (inLibrary && sscanf(line, "Rss: %ld kB", &kB) == 1)
+            sample->rss += kB;
+        else if (inLibrary && sscanf(line, "Private_Dirty: %ld kB", &kB) == 1)
+            sample->privateDirty += kB;
+    }
+    fclose(smaps);
+}
+
+/*
+ * Loads the library once, in the calling process
+ */
+static int loadOnce(const char *library, Sample *sample)
+{
+    struct timeval start, end;
+    struct link_map *map;
+    char path[PATH_MAX];
+    void *handle;
+
+    memset(sample, 0, sizeof(*sample));
+
+    gettimeofday(&start, NULL);
+    handle = dlopen(library, RTLD_NOW | RTLD_LOCAL);
+    gettimeofday(&end, NULL);
+    if (!handle)
+    {
+        fprintf(stderr, "startup_bench: %s\n", dlerror());
+        return 0;
+    }
+    sample->microseconds = (end.tv_sec - start.tv_sec) * 1e6 +
+                           (end.tv_usec - start.tv_usec);
+
+    if (dlinfo(handle, RTLD_DI_LINKMAP, &map) == 0)
+    {
+        countRelocations(map, sample);
+        if (realpath(map->l_name, path))
+            measureMemory(path, sample);
+    }
+    return 1;
+}
+
+static int compareTimes(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv)
+{
+    const char *library = argc > 1 ? argv[1] : LIBRARY_PATH;
+    int runs = argc > 2 ? atoi(argv[2]) : 50;
+    double *times;
+    Sample sample, last;
+    int i, done = 0;
+
+    if (runs < 1)
+        runs = 1;
+    times = (double *)malloc(runs * sizeof(double));
+    if (!times)
+        return 1;
+
+    for (i = 0; i < runs; i++)
+    {
+        int fd[2], status;
+        pid_t child;
+
+        if (pipe(fd))
+            return 1;
+        fflush(stdout);
+        child = fork();
+        if (child < 0)
+            return 1;
+        if (child == 0)
+        {
+            close(fd[0]);
+            if (!loadOnce(library, &sample) ||
+                write(fd[1], &sample, sizeof(sample)) != sizeof(sample))
+                _exit(1);
+            _exit(0);
+        }
+
+        close(fd[1]);
+        if (read(fd[0], &sample, sizeof(sample)) == sizeof(sample))
+        {
+            times[done++] = sample.microseconds;
+            last = sample;
+        }
+        close(fd[0]);
+        waitpid(child, &status, 0);
+    }
+
+    if (!done)
+    {
+        fprintf(stderr, "startup_bench: could not load %s\n", library);
+        return 1;
+    }
+    qsort(times, done, sizeof(double), compareTimes);
+
+    printf("library,relocations,relative,plt,dlopen_us_p50,dlopen_us_p90,rss_kB,private_dirty_kB\n");
+    printf("%s,%ld,%ld,%ld,%.1f,%.1f,%ld,%ld\n", library,
+           last.relocations, last.relative, last.plt,
+           times[done / 2], times[(done * 9) / 10],
+           last.rss, last.privateDirty);
+
+    free(times);
+    return 0;
+}
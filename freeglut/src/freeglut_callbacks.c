@@ -190,6 +190,7 @@ void FGAPIENTRY glutJoystickFunc( void (* callback)
 
     SET_CALLBACK( Joystick );
     fgStructure.CurrentWindow->State.JoystickPollRate = pollInterval;
+    fgStructure.CurrentWindow->State.JoystickSerial = 0;
 
     fgStructure.CurrentWindow->State.JoystickLastPoll =
         fgElapsedTime() - fgStructure.CurrentWindow->State.JoystickPollRate;
@@ -177,12 +177,45 @@ static GLUTproc fghGetGLUTProcAddress( const char* procName )
     CHECK_NAME(glutStrokeHeight);
     CHECK_NAME(glutBitmapString);
     CHECK_NAME(glutStrokeString);
+    CHECK_NAME(glutBitmapLengthN);
+    CHECK_NAME(glutStrokeLengthN);
+    CHECK_NAME(glutBitmapBegin);
+    CHECK_NAME(glutBitmapEnd);
+    CHECK_NAME(glutCreateText);
+    CHECK_NAME(glutUpdateText);
+    CHECK_NAME(glutDrawText);
+    CHECK_NAME(glutGetTextBounds);
+    CHECK_NAME(glutDestroyText);
+    CHECK_NAME(glutLoadBitmapFont);
+    CHECK_NAME(glutTextPosition);
+    CHECK_NAME(glutTextColor);
+    CHECK_NAME(glutTextOrtho);
     CHECK_NAME(glutWireRhombicDodecahedron);
     CHECK_NAME(glutSolidRhombicDodecahedron);
     CHECK_NAME(glutWireSierpinskiSponge);
     CHECK_NAME(glutSolidSierpinskiSponge);
     CHECK_NAME(glutWireCylinder);
     CHECK_NAME(glutSolidCylinder);
+    CHECK_NAME(glutWireSphereAuto);
+    CHECK_NAME(glutSolidSphereAuto);
+    CHECK_NAME(glutWireConeAuto);
+    CHECK_NAME(glutSolidConeAuto);
+    CHECK_NAME(glutWireCylinderAuto);
+    CHECK_NAME(glutSolidCylinderAuto);
+    CHECK_NAME(glutWireTorusAuto);
+    CHECK_NAME(glutSolidTorusAuto);
+    CHECK_NAME(glutWireCubef);
+    CHECK_NAME(glutSolidCubef);
+    CHECK_NAME(glutWireSpheref);
+    CHECK_NAME(glutSolidSpheref);
+    CHECK_NAME(glutWireConef);
+    CHECK_NAME(glutSolidConef);
+    CHECK_NAME(glutWireCylinderf);
+    CHECK_NAME(glutSolidCylinderf);
+    CHECK_NAME(glutWireTorusf);
+    CHECK_NAME(glutSolidTorusf);
+    CHECK_NAME(glutWireTeapotLOD);
+    CHECK_NAME(glutSolidTeapotLOD);
     CHECK_NAME(glutGetProcAddress);
     CHECK_NAME(glutMouseWheelFunc);
     CHECK_NAME(glutJoystickGetNumAxes);
@@ -28,68 +28,2491 @@
 #include <GL/freeglut.h>
 #include "freeglut_internal.h"
 
+#include <stddef.h>
+
+#if TARGET_HOST_POSIX_X11
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#endif
+
+/*
+ * OpenGL 1.2 to 3.2 tokens used by the core profile text renderer, which
+ * older headers lack
+ */
+#ifndef GL_CLAMP_TO_EDGE
+#define GL_CLAMP_TO_EDGE                0x812F
+#endif
+#ifndef GL_TEXTURE0
+#define GL_TEXTURE0                     0x84C0
+#define GL_ACTIVE_TEXTURE               0x84E0
+#endif
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER                 0x8892
+#define GL_ELEMENT_ARRAY_BUFFER         0x8893
+#define GL_ARRAY_BUFFER_BINDING         0x8894
+#define GL_STREAM_DRAW                  0x88E0
+#define GL_STATIC_DRAW                  0x88E4
+#endif
+#ifndef GL_VERTEX_SHADER
+#define GL_FRAGMENT_SHADER              0x8B30
+#define GL_VERTEX_SHADER                0x8B31
+#define GL_COMPILE_STATUS               0x8B81
+#define GL_LINK_STATUS                  0x8B82
+#define GL_CURRENT_PROGRAM              0x8B8D
+#endif
+#ifndef GL_R8
+#define GL_R8                           0x8229
+#endif
+#ifndef GL_VERTEX_ARRAY_BINDING
+#define GL_VERTEX_ARRAY_BINDING         0x85B5
+#endif
+#ifndef GL_CONTEXT_FLAGS
+#define GL_CONTEXT_FLAGS                0x821E
+#define GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT 0x0001
+#endif
+#ifndef GL_CONTEXT_PROFILE_MASK
+#define GL_CONTEXT_PROFILE_MASK         0x9126
+#define GL_CONTEXT_CORE_PROFILE_BIT     0x0001
+#endif
+
+/*
+ * TODO BEFORE THE STABLE RELEASE:
+ *
+ *  Test things out ...
+ */
+
+/* -- IMPORT DECLARATIONS -------------------------------------------------- */
+
+/*
+ * These are the font faces defined in freeglut_font_data.c file:
+ */
+extern SFG_Font fgFontFixed8x13;
+extern SFG_Font fgFontFixed9x15;
+extern SFG_Font fgFontHelvetica10;
+extern SFG_Font fgFontHelvetica12;
+extern SFG_Font fgFontHelvetica18;
+extern SFG_Font fgFontTimesRoman10;
+extern SFG_Font fgFontTimesRoman24;
+extern SFG_StrokeFont fgStrokeRoman;
+extern SFG_StrokeFont fgStrokeMonoRoman;
+
+
+/* -- PRIVATE FUNCTIONS ---------------------------------------------------- */
+
+/*
+ * The font registry. The built-in fonts come first, in the order of
+ * their IDs on Windows; fonts loaded by glutLoadBitmapFont() follow,
+ * and get IDs counting up from FGH_LOADED_FONT_ID. No object lives at
+ * such a low address, so these never clash with the built-in IDs.
+ */
+#define  FGH_NUM_BUILTIN_FONTS      9
+#define  FGH_MAX_LOADED_FONTS       256
+#define  FGH_LOADED_FONT_ID         0x0100
+
+static SFG_FontEntry fghFontRegistry[ FGH_NUM_BUILTIN_FONTS +
+                                      FGH_MAX_LOADED_FONTS ] =
+{
+    { GLUT_STROKE_ROMAN,         NULL,                &fgStrokeRoman     },
+    { GLUT_STROKE_MONO_ROMAN,    NULL,                &fgStrokeMonoRoman },
+    { GLUT_BITMAP_9_BY_15,       &fgFontFixed9x15,    NULL               },
+    { GLUT_BITMAP_8_BY_13,       &fgFontFixed8x13,    NULL               },
+    { GLUT_BITMAP_TIMES_ROMAN_10, &fgFontTimesRoman10, NULL              },
+    { GLUT_BITMAP_TIMES_ROMAN_24, &fgFontTimesRoman24, NULL              },
+    { GLUT_BITMAP_HELVETICA_10,  &fgFontHelvetica10,  NULL               },
+    { GLUT_BITMAP_HELVETICA_12,  &fgFontHelvetica12,  NULL               },
+    { GLUT_BITMAP_HELVETICA_18,  &fgFontHelvetica18,  NULL               }
+};
+static int fghNumLoadedFonts = 0;
+
+/*
+ * Finds a font ID in the registry. Loaded fonts are found by indexing
+ * and the built-in ones by comparing against the few built-in IDs.
+ */
+static const SFG_FontEntry* fghFontEntry( void* font )
+{
+    size_t id = ( size_t )font;
+    int i;
+
+    if( ( id >= FGH_LOADED_FONT_ID ) &&
+        ( id < FGH_LOADED_FONT_ID + ( size_t )fghNumLoadedFonts ) )
+        return fghFontRegistry + FGH_NUM_BUILTIN_FONTS +
+               ( id - FGH_LOADED_FONT_ID );
+
+    /* On Windows the built-in IDs are the registry indices */
+    if( ( id < FGH_NUM_BUILTIN_FONTS ) && ( fghFontRegistry[ id ].ID == font ) )
+        return fghFontRegistry + id;
+
+    for( i = 0; i < FGH_NUM_BUILTIN_FONTS; i++ )
+        if( fghFontRegistry[ i ].ID == font )
+            return fghFontRegistry + i;
+
+    return NULL;
+}
+
+/*
+ * Matches a font ID with a SFG_Font structure pointer.
+ * This was changed to match the GLUT header style.
+ */
+static SFG_Font* fghFindFont( void* font )
+{
+    const SFG_FontEntry* entry = fghFontEntry( font );
+
+    return entry ? entry->Font : NULL;
+}
+
+static SFG_Font* fghFontByID( void* font )
+{
+    SFG_Font* result = fghFindFont( font );
+
+    if( !result )
+        fgWarning( "font 0x%08x not found", font );
+    return result;
+}
+
+/*
+ * Matches a font ID with a SFG_StrokeFont structure pointer.
+ * This was changed to match the GLUT header style.
+ */
+static SFG_StrokeFont* fghFindStroke( void* font )
+{
+    const SFG_FontEntry* entry = fghFontEntry( font );
+
+    return entry ? entry->StrokeFont : NULL;
+}
+
+static SFG_StrokeFont* fghStrokeByID( void* font )
+{
+    SFG_StrokeFont* result = fghFindStroke( font );
+
+    if( !result )
+        fgWarning( "stroke font 0x%08x not found", font );
+    return result;
+}
+
+/*
+ * Strings are UTF-8. Characters past a font's Quantity, which only fonts
+ * loaded from files have, are kept in pages of FGH_PAGE_SIZE allocated
+ * as they are used, so memory follows the characters actually drawn.
+ */
+#define  FGH_MAX_CHARACTER          0x10FFFF
+#define  FGH_PAGE_SIZE              256
+#define  FGH_NUM_PAGES              ( ( FGH_MAX_CHARACTER + 1 ) / FGH_PAGE_SIZE )
+
+/*
+ * Decodes the UTF-8 character at *string and moves past it. A byte that
+ * doesn't start a well formed sequence stands for itself, so strings in
+ * Latin-1, which the built-in fonts are encoded in, still draw as before.
+ */
+static unsigned int fghNextCharacter( const unsigned char** string )
+{
+    const unsigned char* s = *string;
+    unsigned int c = *s++, d;
+
+    if( c < 0xC2 )
+        ;   /* ASCII, or a stray continuation byte */
+    else if( c < 0xE0 )
+    {
+        if( ( s[ 0 ] & 0xC0 ) == 0x80 )
+        {
+            c = ( ( c & 0x1F ) << 6 ) | ( s[ 0 ] & 0x3F );
+            s += 1;
+        }
+    }
+    else if( c < 0xF0 )
+    {
+        if( ( ( s[ 0 ] & 0xC0 ) == 0x80 ) && ( ( s[ 1 ] & 0xC0 ) == 0x80 ) )
+        {
+            d = ( ( c & 0x0F ) << 12 ) | ( ( s[ 0 ] & 0x3F ) << 6 ) |
+                ( s[ 1 ] & 0x3F );
+            if( ( d >= 0x800 ) && ( ( d < 0xD800 ) || ( d > 0xDFFF ) ) )
+            {
+                c = d;
+                s += 2;
+            }
+        }
+    }
+    else if( c < 0xF5 )
+    {
+        if( ( ( s[ 0 ] & 0xC0 ) == 0x80 ) && ( ( s[ 1 ] & 0xC0 ) == 0x80 ) &&
+            ( ( s[ 2 ] & 0xC0 ) == 0x80 ) )
+        {
+            d = ( ( c & 0x07 ) << 18 ) | ( ( s[ 0 ] & 0x3F ) << 12 ) |
+                ( ( s[ 1 ] & 0x3F ) << 6 ) | ( s[ 2 ] & 0x3F );
+            if( ( d >= 0x10000 ) && ( d <= FGH_MAX_CHARACTER ) )
+            {
+                c = d;
+                s += 3;
+            }
+        }
+    }
+
+    *string = s;
+    return c;
+}
+
+/* Most text is ASCII, which skips the call */
+#define  FGH_NEXT_CHARACTER( s )    ( ( *( s ) < 0x80 ) ? *( s )++ : \
+                                      fghNextCharacter( &( s ) ) )
+
+/*
+ * Like fghNextCharacter(), for strings that end at end rather than at a
+ * NUL, unless end is NULL. A sequence cut short by the end is broken like
+ * any other, and its first byte stands for itself.
+ */
+static unsigned int fghNextCharacterN( const unsigned char** string,
+                                       const unsigned char* end )
+{
+    const unsigned char* s = *string;
+    int trail = ( *s < 0xC2 ) ? 0 : ( *s < 0xE0 ) ? 1 :
+                ( *s < 0xF0 ) ? 2 : ( *s < 0xF5 ) ? 3 : 0;
+
+    if( !end || ( end - s > trail ) )
+        return fghNextCharacter( string );
+    *string = s + 1;
+    return *s;
+}
+
+/*
+ * The glyphs of loaded fonts start with a header: the advance, the
+ * bitmap's width and height, and its origin as glBitmap() takes it,
+ * each offset by 128. The glyph's own box keeps the ink that sticks out
+ * left of the origin or past the advance, as italics and accents do.
+ */
+#define  FGH_GLYPH_HEADER           5
+#define  FGH_GLYPH_ORIGIN_BIAS      128
+
+/*
+ * Stands in for the characters a font doesn't have
+ */
+static const GLubyte fghNoGlyph[ FGH_GLYPH_HEADER ] =
+    { 0, 0, 0, FGH_GLYPH_ORIGIN_BIAS, FGH_GLYPH_ORIGIN_BIAS };
+
+/*
+ * Returns the rows of a glyph from fghGlyph(), bottom first and bits MSB
+ * first, with the bitmap's size and origin. A built-in font's glyph is a
+ * cell as wide as its advance and as tall as the font, at the font's
+ * origin.
+ */
+static const GLubyte* fghGlyphBitmap( const SFG_Font* font, const GLubyte* face,
+                                      int* width, int* height, GLfloat* origin )
+{
+    if( !font->File )
+    {
+        *width = face[ 0 ];
+        *height = font->Height;
+        origin[ 0 ] = font->xorig;
+        origin[ 1 ] = font->yorig;
+        return face + 1;
+    }
+
+    *width = face[ 1 ];
+    *height = face[ 2 ];
+    origin[ 0 ] = ( GLfloat )( face[ 3 ] - FGH_GLYPH_ORIGIN_BIAS );
+    origin[ 1 ] = ( GLfloat )( face[ 4 ] - FGH_GLYPH_ORIGIN_BIAS );
+    return face + FGH_GLYPH_HEADER;
+}
+
+/*
+ * Converts a glyph bitmap, rows top first and bits MSB first, into the
+ * layout of a loaded font's glyph. The glyph's lower left corner is at
+ * ( left, bottom ) from the origin. Anything past what the header can
+ * describe is clipped, which no real bitmap font comes near.
+ */
+static GLubyte* fghMakeFace( int advance, int width, int height,
+                             int left, int bottom,
+                             const GLubyte* bits, int stride )
+{
+    GLubyte* face;
+    int faceStride, rows, r;
+
+    if( advance < 0 )
+        advance = 0;
+    if( advance > 255 )
+        advance = 255;
+    if( ( width <= 0 ) || ( height <= 0 ) )
+        width = height = left = bottom = 0;
+    if( width > 255 )
+        width = 255;
+    rows = ( height > 255 ) ? 255 : height;
+    if( left < 1 - FGH_GLYPH_ORIGIN_BIAS )
+        left = 1 - FGH_GLYPH_ORIGIN_BIAS;
+    if( left > FGH_GLYPH_ORIGIN_BIAS )
+        left = FGH_GLYPH_ORIGIN_BIAS;
+    if( bottom < 1 - FGH_GLYPH_ORIGIN_BIAS )
+        bottom = 1 - FGH_GLYPH_ORIGIN_BIAS;
+    if( bottom > FGH_GLYPH_ORIGIN_BIAS )
+        bottom = FGH_GLYPH_ORIGIN_BIAS;
+    faceStride = ( width + 7 ) / 8;
+
+    face = ( GLubyte * )malloc( FGH_GLYPH_HEADER + faceStride * rows );
+    if( !face )
+        return NULL;
+    face[ 0 ] = ( GLubyte )advance;
+    face[ 1 ] = ( GLubyte )width;
+    face[ 2 ] = ( GLubyte )rows;
+    face[ 3 ] = ( GLubyte )( FGH_GLYPH_ORIGIN_BIAS - left );
+    face[ 4 ] = ( GLubyte )( FGH_GLYPH_ORIGIN_BIAS - bottom );
+
+    /* Bottom row first; a glyph too tall loses its top rows */
+    for( r = 0; r < rows; r++ )
+    {
+        const GLubyte* row = bits + ( height - 1 - r ) * stride;
+        GLubyte* out = face + FGH_GLYPH_HEADER + r * faceStride;
+
+        memcpy( out, row, faceStride );
+        if( width % 8 )
+            out[ faceStride - 1 ] &= ( GLubyte )( 0xFF << ( 8 - width % 8 ) );
+    }
+    return face;
+}
+
+/*
+ * Copies the BDF line at *pos into line[], cut short at size - 1
+ * characters, and moves *pos on to the next line. Returns GL_FALSE
+ * at the end of the file.
+ */
+static GLboolean fghBDFLine( const SFG_FontFile* file, size_t* pos,
+                             char* line, int size )
+{
+    int n = 0;
+
+    if( *pos >= file->Size )
+        return GL_FALSE;
+
+    while( ( *pos < file->Size ) && ( file->Data[ *pos ] != '\n' ) )
+    {
+        if( ( n < size - 1 ) && ( file->Data[ *pos ] != '\r' ) )
+            line[ n++ ] = ( char )file->Data[ *pos ];
+        ( *pos )++;
+    }
+    if( *pos < file->Size )
+        ( *pos )++;
+
+    line[ n ] = '\0';
+    return GL_TRUE;
+}
+
+static GLboolean fghBDFKeyword( const char* line, const char* keyword )
+{
+    size_t n = strlen( keyword );
+
+    return ( strncmp( line, keyword, n ) == 0 ) &&
+           ( ( line[ n ] == ' ' ) || ( line[ n ] == '\t' ) ||
+             ( line[ n ] == '\0' ) );
+}
+
+static int fghHexDigit( char c )
+{
+    if( ( c >= '0' ) && ( c <= '9' ) )
+        return c - '0';
+    if( ( c >= 'A' ) && ( c <= 'F' ) )
+        return c - 'A' + 10;
+    if( ( c >= 'a' ) && ( c <= 'f' ) )
+        return c - 'a' + 10;
+    return -1;
+}
+
+/*
+ * Converts the BDF character starting at the given file offset
+ */
+static GLubyte* fghLoadBDFGlyph( const SFG_Font* font, long offset )
+{
+    const SFG_FontFile* file = font->File;
+    size_t pos = ( size_t )offset;
+    char line[ 256 ];
+    int advance = 0, width = 0, height = 0, left = 0, bottom = 0;
+    int stride = 0, i, k;
+    GLubyte *bits = NULL, *face;
+
+    while( fghBDFLine( file, &pos, line, sizeof( line ) ) )
+        if( fghBDFKeyword( line, "DWIDTH" ) )
+            sscanf( line + 6, "%d", &advance );
+        else if( fghBDFKeyword( line, "BBX" ) )
+            sscanf( line + 3, "%d %d %d %d", &width, &height, &left, &bottom );
+        else if( fghBDFKeyword( line, "BITMAP" ) )
+        {
+            if( ( width <= 0 ) || ( height <= 0 ) )
+                break;
+            stride = ( width + 7 ) / 8;
+            bits = ( GLubyte * )calloc( stride * height, 1 );
+            if( !bits )
+                return NULL;
+
+            /* One row per line, in hex, padded to whole bytes */
+            for( k = 0; k < height; k++ )
+            {
+                if( !fghBDFLine( file, &pos, line, sizeof( line ) ) )
+                    break;
+                for( i = 0; i < stride; i++ )
+                {
+                    int high = fghHexDigit( line[ 2 * i ] );
+                    int low = ( high < 0 ) ? -1 : fghHexDigit( line[ 2 * i + 1 ] );
+
+                    if( low < 0 )
+                        break;
+                    bits[ k * stride + i ] = ( GLubyte )( high * 16 + low );
+                }
+            }
+            break;
+        }
+        else if( fghBDFKeyword( line, "ENDCHAR" ) )
+            break;
+
+    if( !bits )
+        width = height = 0;
+    face = fghMakeFace( advance, width, height, left, bottom, bits, stride );
+    free( bits );
+    return face;
+}
+
+/*
+ * Finds the characters of a BDF font, without converting any of them
+ */
+static GLboolean fghIndexBDF( SFG_Font* font )
+{
+    SFG_FontFile* file = font->File;
+    size_t pos = 0, start = 0, line_start;
+    char line[ 256 ];
+    int ascent = -1, descent = -1, defaultChar = -1;
+    int boxWidth, boxHeight = 0, boxLeft, boxBottom = 0, c, i;
+
+    if( !fghBDFLine( file, &pos, line, sizeof( line ) ) ||
+        !fghBDFKeyword( line, "STARTFONT" ) )
+        return GL_FALSE;
+
+    file->Glyphs = ( long ** )calloc( FGH_NUM_PAGES, sizeof( long * ) );
+    if( !file->Glyphs )
+        fgError( "Failed to allocate memory in fghIndexBDF" );
+
+    for( line_start = pos;
+         fghBDFLine( file, &pos, line, sizeof( line ) );
+         line_start = pos )
+        if( fghBDFKeyword( line, "STARTCHAR" ) )
+            start = line_start;
+        else if( fghBDFKeyword( line, "ENCODING" ) )
+        {
+            if( sscanf( line + 8, "%d", &c ) != 1 )
+                continue;
+            if( ( defaultChar >= 0 ) && ( c == defaultChar ) )
+                file->DefaultGlyph = ( long )start;
+            if( ( c >= 0 ) && ( c <= FGH_MAX_CHARACTER ) )
+            {
+                long** page = file->Glyphs + c / FGH_PAGE_SIZE;
+
+                if( !*page )
+                {
+                    *page = ( long * )malloc( FGH_PAGE_SIZE * sizeof( long ) );
+                    if( !*page )
+                        fgError( "Failed to allocate memory in fghIndexBDF" );
+                    for( i = 0; i < FGH_PAGE_SIZE; i++ )
+                        ( *page )[ i ] = -1;
+                }
+                ( *page )[ c % FGH_PAGE_SIZE ] = ( long )start;
+            }
+        }
+        else if( fghBDFKeyword( line, "FONTBOUNDINGBOX" ) )
+            sscanf( line + 15, "%d %d %d %d",
+                    &boxWidth, &boxHeight, &boxLeft, &boxBottom );
+        else if( fghBDFKeyword( line, "FONT_ASCENT" ) )
+            sscanf( line + 11, "%d", &ascent );
+        else if( fghBDFKeyword( line, "FONT_DESCENT" ) )
+            sscanf( line + 12, "%d", &descent );
+        else if( fghBDFKeyword( line, "DEFAULT_CHAR" ) )
+            sscanf( line + 12, "%d", &defaultChar );
+
+    if( ( ascent >= 0 ) && ( descent >= 0 ) )
+    {
+        font->Height = ascent + descent;
+        font->yorig = ( float )descent;
+    }
+    else
+    {
+        font->Height = boxHeight;
+        font->yorig = ( float )-boxBottom;
+    }
+    return GL_TRUE;
+}
+
+/*
+ * PCF files are a table of contents followed by tables, each of which
+ * starts with a format word telling its byte and bit order, see the X
+ * server's pcf.h
+ */
+#define  FGH_PCF_ACCELERATORS       ( 1 << 1 )
+#define  FGH_PCF_METRICS            ( 1 << 2 )
+#define  FGH_PCF_BITMAPS            ( 1 << 3 )
+#define  FGH_PCF_BDF_ENCODINGS      ( 1 << 5 )
+#define  FGH_PCF_BDF_ACCELERATORS   ( 1 << 8 )
+
+#define  FGH_PCF_COMPRESSED_METRICS 0x0100
+#define  FGH_PCF_BYTE_MSB_FIRST     ( 1 << 2 )
+#define  FGH_PCF_BIT_MSB_FIRST      ( 1 << 3 )
+
+/*
+ * Reads an unsigned 16 or 32 bit number in a table's byte order, or 0
+ * past the end of the file
+ */
+static unsigned long fghPCFNumber( const SFG_FontFile* file, long pos,
+                                   int format, int bytes )
+{
+    unsigned long value = 0;
+    int i;
+
+    if( ( pos < 0 ) || ( ( size_t )pos + bytes > file->Size ) )
+        return 0;
+
+    for( i = 0; i < bytes; i++ )
+        if( format & FGH_PCF_BYTE_MSB_FIRST )
+            value = ( value << 8 ) | file->Data[ pos + i ];
+        else
+            value |= ( unsigned long )file->Data[ pos + i ] << ( 8 * i );
+    return value;
+}
+
+static int fghPCFShort( const SFG_FontFile* file, long pos, int format )
+{
+    int value = ( int )fghPCFNumber( file, pos, format, 2 );
+
+    return ( value >= 0x8000 ) ? value - 0x10000 : value;
+}
+
+/*
+ * Reads the metrics of a PCF glyph: left and right bearing, advance,
+ * ascent and descent
+ */
+static void fghPCFMetrics( const SFG_FontFile* file, long glyph, int* m )
+{
+    int i;
+
+    if( file->MetricsFormat & FGH_PCF_COMPRESSED_METRICS )
+        for( i = 0; i < 5; i++ )
+            m[ i ] = ( int )fghPCFNumber( file, file->Metrics + 5 * glyph + i,
+                                          0, 1 ) - 0x80;
+    else
+        for( i = 0; i < 5; i++ )
+            m[ i ] = fghPCFShort( file, file->Metrics + 12 * glyph + 2 * i,
+                                  file->MetricsFormat );
+}
+
+/*
+ * Converts a PCF glyph to MSB first bits and then to the SFG_Font layout
+ */
+static GLubyte* fghLoadPCFGlyph( const SFG_Font* font, long glyph )
+{
+    const SFG_FontFile* file = font->File;
+    int format = file->BitmapsFormat, m[ 5 ], width, height, pad, unit, stride;
+    long data;
+    GLubyte *bits, *face;
+    int i, j;
+
+    fghPCFMetrics( file, glyph, m );
+    width = m[ 1 ] - m[ 0 ];
+    height = m[ 3 ] + m[ 4 ];
+    if( ( width <= 0 ) || ( height <= 0 ) )
+        return fghMakeFace( m[ 2 ], 0, 0, 0, 0, NULL, 0 );
+
+    /* Rows are padded to 1, 2, 4 or 8 bytes */
+    pad = 1 << ( format & 3 );
+    unit = 1 << ( ( format >> 4 ) & 3 );
+    stride = ( ( width + 8 * pad - 1 ) / ( 8 * pad ) ) * pad;
+    data = file->Bitmaps + 8 + 4 * file->NumGlyphs + 16 +
+           ( long )fghPCFNumber( file, file->Bitmaps + 8 + 4 * glyph, format, 4 );
+    if( ( size_t )data + stride * height > file->Size )
+        return fghMakeFace( m[ 2 ], 0, 0, 0, 0, NULL, 0 );
+
+    bits = ( GLubyte * )malloc( stride * height );
+    if( !bits )
+        return NULL;
+    memcpy( bits, file->Data + data, stride * height );
+
+    /* Bytes within a scan unit are stored in the bit order's sense */
+    if( ( unit > 1 ) && ( stride % unit == 0 ) &&
+        ( !( format & FGH_PCF_BYTE_MSB_FIRST ) !=
+          !( format & FGH_PCF_BIT_MSB_FIRST ) ) )
+        for( i = 0; i < stride * height; i += unit )
+            for( j = 0; j < unit / 2; j++ )
+            {
+                GLubyte b = bits[ i + j ];
+
+                bits[ i + j ] = bits[ i + unit - 1 - j ];
+                bits[ i + unit - 1 - j ] = b;
+            }
+    if( !( format & FGH_PCF_BIT_MSB_FIRST ) )
+        for( i = 0; i < stride * height; i++ )
+        {
+            GLubyte b = bits[ i ], r = 0;
+
+            for( j = 0; j < 8; j++, b >>= 1 )
+                r = ( GLubyte )( ( r << 1 ) | ( b & 1 ) );
+            bits[ i ] = r;
+        }
+
+    face = fghMakeFace( m[ 2 ], width, height, m[ 0 ], -m[ 4 ], bits, stride );
+    free( bits );
+    return face;
+}
+
+/*
+ * Looks a character up in the PCF encoding table, which covers the Basic
+ * Multilingual Plane as rows of byte1 and columns of byte2
+ */
+static long fghPCFGlyph( const SFG_FontFile* file, unsigned int c )
+{
+    long table = file->Encodings;
+    int format = file->EncodingsFormat;
+    int minByte2 = fghPCFShort( file, table + 4, format );
+    int maxByte2 = fghPCFShort( file, table + 6, format );
+    int minByte1 = fghPCFShort( file, table + 8, format );
+    int maxByte1 = fghPCFShort( file, table + 10, format );
+    int byte1 = ( int )( c >> 8 ), byte2 = ( int )( c & 0xff );
+    long glyph;
+
+    if( ( byte1 < minByte1 ) || ( byte1 > maxByte1 ) ||
+        ( byte2 < minByte2 ) || ( byte2 > maxByte2 ) )
+        return -1;
+
+    glyph = ( long )fghPCFNumber( file, table + 14 + 2 *
+        ( ( byte1 - minByte1 ) * ( maxByte2 - minByte2 + 1 ) +
+          byte2 - minByte2 ), format, 2 );
+    return ( ( glyph == 0xffff ) || ( glyph >= file->NumGlyphs ) ) ? -1 : glyph;
+}
+
+/*
+ * Finds the tables and characters of a PCF font
+ */
+static GLboolean fghIndexPCF( SFG_Font* font )
+{
+    SFG_FontFile* file = font->File;
+    long tables = ( long )fghPCFNumber( file, 4, 0, 4 );
+    long metrics = -1, bitmaps = -1, encodings = -1, accelerators = -1;
+    long i;
+    int format, ascent = 0, descent = 0;
+
+    if( ( tables <= 0 ) || ( ( size_t )( 8 + 16 * tables ) > file->Size ) )
+        return GL_FALSE;
+
+    for( i = 0; i < tables; i++ )
+    {
+        long type = ( long )fghPCFNumber( file, 8 + 16 * i, 0, 4 );
+        long size = ( long )fghPCFNumber( file, 8 + 16 * i + 8, 0, 4 );
+        long offset = ( long )fghPCFNumber( file, 8 + 16 * i + 12, 0, 4 );
+
+        if( ( offset < 0 ) || ( size < 0 ) ||
+            ( ( size_t )offset + size > file->Size ) )
+            return GL_FALSE;
+
+        if( type == FGH_PCF_METRICS )
+            metrics = offset;
+        else if( type == FGH_PCF_BITMAPS )
+            bitmaps = offset;
+        else if( type == FGH_PCF_BDF_ENCODINGS )
+            encodings = offset;
+        else if( ( type == FGH_PCF_BDF_ACCELERATORS ) ||
+                 ( ( type == FGH_PCF_ACCELERATORS ) && ( accelerators < 0 ) ) )
+            accelerators = offset;
+    }
+    if( ( metrics < 0 ) || ( bitmaps < 0 ) || ( encodings < 0 ) )
+        return GL_FALSE;
+
+    file->MetricsFormat = ( int )fghPCFNumber( file, metrics, 0, 4 );
+    if( file->MetricsFormat & FGH_PCF_COMPRESSED_METRICS )
+    {
+        file->NumGlyphs = ( long )fghPCFNumber( file, metrics + 4,
+                                                file->MetricsFormat, 2 );
+        file->Metrics = metrics + 6;
+    }
+    else
+    {
+        file->NumGlyphs = ( long )fghPCFNumber( file, metrics + 4,
+                                                file->MetricsFormat, 4 );
+        file->Metrics = metrics + 8;
+    }
+    file->BitmapsFormat = ( int )fghPCFNumber( file, bitmaps, 0, 4 );
+    file->Bitmaps = bitmaps;
+    if( ( file->NumGlyphs <= 0 ) ||
+        ( ( long )fghPCFNumber( file, bitmaps + 4, file->BitmapsFormat, 4 ) !=
+          file->NumGlyphs ) )
+        return GL_FALSE;
+
+    file->EncodingsFormat = ( int )fghPCFNumber( file, encodings, 0, 4 );
+    file->Encodings = encodings;
+    file->DefaultGlyph = fghPCFGlyph( file, ( unsigned int )
+        fghPCFNumber( file, encodings + 12, file->EncodingsFormat, 2 ) );
+
+    /* The font ascent and descent, or else the tallest glyph's */
+    if( accelerators >= 0 )
+    {
+        format = ( int )fghPCFNumber( file, accelerators, 0, 4 );
+        ascent = ( int )fghPCFNumber( file, accelerators + 12, format, 4 );
+        descent = ( int )fghPCFNumber( file, accelerators + 16, format, 4 );
+    }
+    else
+        for( i = 0; i < file->NumGlyphs; i++ )
+        {
+            int m[ 5 ];
+
+            fghPCFMetrics( file, i, m );
+            if( ascent < m[ 3 ] )
+                ascent = m[ 3 ];
+            if( descent < m[ 4 ] )
+                descent = m[ 4 ];
+        }
+
+    font->Height = ascent + descent;
+    font->yorig = ( float )descent;
+    return GL_TRUE;
+}
+
+/*
+ * Finds a character in a font file, or the file's default character
+ */
+static long fghFileGlyph( const SFG_FontFile* file, unsigned int c )
+{
+    long glyph = -1;
+
+    if( file->Format == FG_FONT_FILE_PCF )
+        glyph = fghPCFGlyph( file, c );
+    else if( file->Glyphs[ c / FGH_PAGE_SIZE ] )
+        glyph = file->Glyphs[ c / FGH_PAGE_SIZE ][ c % FGH_PAGE_SIZE ];
+
+    return ( glyph < 0 ) ? file->DefaultGlyph : glyph;
+}
+
+/*
+ * Returns the glyph of a character, which starts with its advance; see
+ * fghGlyphBitmap() for the rest. Characters of loaded fonts are converted
+ * on first use, those past the font's Quantity into pages allocated as
+ * needed.
+ */
+static const GLubyte* fghGlyph( const SFG_Font* font, unsigned int c )
+{
+    SFG_FontFile* file = font->File;
+    const GLubyte** page = NULL;
+    const GLubyte* face;
+    long glyph;
+
+    if( c < ( unsigned int )font->Quantity )
+    {
+        if( font->Offsets )
+            return font->Data + font->Offsets[ c ];
+        face = font->Characters[ c ];
+        if( face )
+            return face;
+    }
+    else if( !file || ( c > FGH_MAX_CHARACTER ) )
+        return fghNoGlyph;
+    else
+    {
+        if( file->Pages )
+            page = file->Pages[ c / FGH_PAGE_SIZE ];
+        if( page && page[ c % FGH_PAGE_SIZE ] )
+            return page[ c % FGH_PAGE_SIZE ];
+    }
+
+    if( !file || ( ( glyph = fghFileGlyph( file, c ) ) < 0 ) )
+        return fghNoGlyph;
+
+    if( file->Format == FG_FONT_FILE_PCF )
+        face = fghLoadPCFGlyph( font, glyph );
+    else
+        face = fghLoadBDFGlyph( font, glyph );
+    if( !face )
+        return fghNoGlyph;
+
+    if( c < ( unsigned int )font->Quantity )
+        font->Characters[ c ] = face;
+    else
+    {
+        if( !file->Pages )
+            file->Pages = ( const GLubyte *** )calloc( FGH_NUM_PAGES,
+                                                      sizeof( GLubyte ** ) );
+        if( file->Pages && !page )
+            page = file->Pages[ c / FGH_PAGE_SIZE ] =
+                ( const GLubyte ** )calloc( FGH_PAGE_SIZE, sizeof( GLubyte * ) );
+        if( !page )
+            fgError( "Failed to allocate memory in fghGlyph" );
+        page[ c % FGH_PAGE_SIZE ] = face;
+    }
+    return face;
+}
+
+/*
+ * Returns the advances of the font's first Quantity characters as one
+ * table, so strings are measured without looking at every glyph. The
+ * built-in fonts come with theirs; a loaded font's is made, converting
+ * those characters, the first time it is measured.
+ */
+static const GLubyte* fghAdvances( SFG_Font* font )
+{
+    GLubyte* advances;
+    int c;
+
+    if( font->Advances )
+        return font->Advances;
+
+    advances = ( GLubyte * )malloc( font->Quantity );
+    if( !advances )
+        fgError( "Failed to allocate memory in fghAdvances" );
+    for( c = 0; c < font->Quantity; c++ )
+        advances[ c ] = fghGlyph( font, c )[ 0 ];
+    font->File->Advances = advances;
+    font->Advances = advances;
+    return advances;
+}
+
+/*
+ * Returns the width of the widest line of a string, from string up to
+ * end. Runs of plain ASCII, which is most text, are found first and then
+ * summed straight from the advance table in a loop that the compiler
+ * can vectorise.
+ */
+static int fghBitmapLength( SFG_Font* font, const unsigned char* string,
+                            const unsigned char* end )
+{
+    const GLubyte* advances = fghAdvances( font );
+    int length = 0, this_line_length = 0;
+
+    while( string < end )
+    {
+        const unsigned char* run = string;
+        unsigned int c;
+
+        while( ( run < end ) && ( *run < 0x80 ) && ( *run != '\n' ) )
+            run++;
+        for( ; string < run; string++ )
+            this_line_length += advances[ *string ];
+        if( string == end )
+            break;
+
+        if( *string == '\n' )  /* EOL; reset the length of this line */
+        {
+            if( length < this_line_length )
+                length = this_line_length;
+            this_line_length = 0;
+            string++;
+        }
+        else if( ( c = fghNextCharacterN( &string, end ) ) <
+                 ( unsigned int )font->Quantity )
+            this_line_length += advances[ c ];
+        else
+            this_line_length += *fghGlyph( font, c );
+    }
+    if( length < this_line_length )
+        length = this_line_length;
+
+    return length;
+}
+
+/*
+ * Maps a font file into memory, read only
+ */
+static GLboolean fghMapFontFile( SFG_FontFile* file, const char* path )
+{
+#if TARGET_HOST_POSIX_X11
+    struct stat status;
+    void* data;
+    int fd = open( path, O_RDONLY );
+
+    if( fd < 0 )
+        return GL_FALSE;
+    if( fstat( fd, &status ) || ( status.st_size <= 0 ) )
+    {
+        close( fd );
+        return GL_FALSE;
+    }
+    data = mmap( NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if( data == MAP_FAILED )
+        return GL_FALSE;
+
+    file->Data = ( const GLubyte * )data;
+    file->Size = status.st_size;
+    return GL_TRUE;
+#elif TARGET_HOST_MS_WINDOWS && !defined(_WIN32_WCE)
+    HANDLE handle = CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+    DWORD size;
+
+    if( handle == INVALID_HANDLE_VALUE )
+        return GL_FALSE;
+    size = GetFileSize( handle, NULL );
+    if( ( size != 0 ) && ( size != 0xFFFFFFFF ) )
+        file->Mapping = CreateFileMapping( handle, NULL, PAGE_READONLY,
+                                           0, 0, NULL );
+    CloseHandle( handle );
+    if( !file->Mapping )
+        return GL_FALSE;
+
+    file->Data = ( const GLubyte * )MapViewOfFile( file->Mapping,
+                                                   FILE_MAP_READ, 0, 0, 0 );
+    if( !file->Data )
+    {
+        CloseHandle( file->Mapping );
+        file->Mapping = NULL;
+        return GL_FALSE;
+    }
+    file->Size = size;
+    return GL_TRUE;
+#else
+    return GL_FALSE;
+#endif
+}
+
+/*
+ * Frees a loaded font, its converted characters and its file mapping
+ */
+static void fghFreeLoadedFont( SFG_Font* font )
+{
+    SFG_FontFile* file = font->File;
+    int c, i;
+
+    if( file->Data )
+    {
+#if TARGET_HOST_POSIX_X11
+        munmap( ( void * )file->Data, file->Size );
+#elif TARGET_HOST_MS_WINDOWS && !defined(_WIN32_WCE)
+        UnmapViewOfFile( ( LPCVOID )file->Data );
+        CloseHandle( file->Mapping );
+#endif
+    }
+
+    if( font->Characters )
+        for( c = 0; c < font->Quantity; c++ )
+            free( ( void * )font->Characters[ c ] );
+    free( ( void * )font->Characters );
+
+    for( i = 0; i < FGH_NUM_PAGES; i++ )
+    {
+        if( file->Glyphs )
+            free( file->Glyphs[ i ] );
+        if( file->Pages && file->Pages[ i ] )
+        {
+            for( c = 0; c < FGH_PAGE_SIZE; c++ )
+                free( ( void * )file->Pages[ i ][ c ] );
+            free( ( void * )file->Pages[ i ] );
+        }
+    }
+    free( file->Glyphs );
+    free( ( void * )file->Pages );
+    free( file->Advances );
+    free( file );
+    free( font->Name );
+    free( font );
+}
+
+/*
+ * Frees the fonts loaded by glutLoadBitmapFont()
+ */
+void fgDestroyLoadedFonts( void )
+{
+    int i;
+
+    for( i = 0; i < fghNumLoadedFonts; i++ )
+    {
+        SFG_FontEntry* entry = fghFontRegistry + FGH_NUM_BUILTIN_FONTS + i;
+
+        fghFreeLoadedFont( entry->Font );
+        entry->ID = NULL;
+        entry->Font = NULL;
+    }
+    fghNumLoadedFonts = 0;
+}
+
+/*
+ * The font of the glutBitmapBegin()/glutBitmapEnd() scope, if one is
+ * open. The pixel store is set up for glBitmap() while it is.
+ */
+static void*     fghBitmapScopeID = NULL;
+static SFG_Font* fghBitmapScopeFont = NULL;
+static GLboolean fghBitmapScopePushed = GL_FALSE;
+
+/*
+ * Sets the pixel unpack state the font bitmaps are stored in. The
+ * caller pushes GL_CLIENT_PIXEL_STORE_BIT first.
+ */
+static void fghSetPixelStore( void )
+{
+    glPixelStorei( GL_UNPACK_SWAP_BYTES,  GL_FALSE );
+    glPixelStorei( GL_UNPACK_LSB_FIRST,   GL_FALSE );
+    glPixelStorei( GL_UNPACK_ROW_LENGTH,  0        );
+    glPixelStorei( GL_UNPACK_SKIP_ROWS,   0        );
+    glPixelStorei( GL_UNPACK_SKIP_PIXELS, 0        );
+    glPixelStorei( GL_UNPACK_ALIGNMENT,   1        );
+}
+
+/*
+ * The bitmap font atlases built so far, and the vertex batch that the
+ * atlas path of glutBitmapString() assembles its quads in.
+ */
+static SFG_List fghFontAtlases = { NULL, NULL };
+static GLfloat* fghTextBatch = NULL;
+static int      fghTextBatchQuads = 0;
+
+/*
+ * The text state of each context text has been drawn in, and the one
+ * looked up last, which is nearly always the one wanted next
+ */
+static SFG_List         fghTextContexts = { NULL, NULL };
+static SFG_TextContext* fghLastTextContext = NULL;
+
+static SFG_TextContext* fghFindTextContext( SFG_WindowContextType context )
+{
+    SFG_TextContext* text;
+
+    if( fghLastTextContext && ( fghLastTextContext->Context == context ) )
+        return fghLastTextContext;
+
+    for( text = ( SFG_TextContext * )fghTextContexts.First;
+         text;
+         text = ( SFG_TextContext * )text->Node.Next )
+        if( text->Context == context )
+            return fghLastTextContext = text;
+
+    return NULL;
+}
+
+/*
+ * Returns the text state of a window's context, making it the first time
+ */
+static SFG_TextContext* fghTextContext( SFG_Window* window )
+{
+    SFG_TextContext* text = fghFindTextContext( window->Window.Context );
+
+    if( text )
+        return text;
+
+    text = ( SFG_TextContext * )calloc( sizeof( SFG_TextContext ), 1 );
+    if( !text )
+        fgError( "Failed to allocate memory in fghTextContext" );
+    text->Context = window->Window.Context;
+    fgListInit( &text->FontTextures );
+    fgListAppend( &fghTextContexts, &text->Node );
+    return fghLastTextContext = text;
+}
+
+/*
+ * Expands count characters of a bitmap font, from first on, into an
+ * alpha texture image on first use. The glyphs are packed into rows with
+ * a one texel gap between them, in the same bottom-up row order glBitmap()
+ * reads them in, and each one's box around its origin is kept for laying
+ * out the quads.
+ */
+static SFG_FontAtlas* fghFontAtlas( const SFG_Font* font,
+                                    unsigned int first, int count )
+{
+    SFG_FontAtlas* atlas;
+    GLfloat origin[ 2 ];
+    int c, i, r, w, h, x, y, width = 256, height = 1, rowHeight = 0;
+
+    for( atlas = ( SFG_FontAtlas * )fghFontAtlases.First;
+         atlas;
+         atlas = ( SFG_FontAtlas * )atlas->Node.Next )
+        if( ( atlas->Font == font ) && ( atlas->First == first ) )
+            return atlas;
+
+    /* Loaded fonts may have glyphs wider than the usual 256 texels */
+    for( c = 0; c < count; c++ )
+    {
+        fghGlyphBitmap( font, fghGlyph( font, first + c ), &w, &h, origin );
+        while( width < w + 2 )
+            width <<= 1;
+        if( rowHeight < h )
+            rowHeight = h;
+    }
+
+    /* Lay the glyphs out once to find the texture height */
+    x = y = 1;
+    for( c = 0; c < count; c++ )
+    {
+        fghGlyphBitmap( font, fghGlyph( font, first + c ), &w, &h, origin );
+        if( x + w + 1 > width )
+        {
+            x = 1;
+            y += rowHeight + 1;
+        }
+        x += w + 1;
+    }
+    y += rowHeight + 1;
+    while( height < y )
+        height <<= 1;
+
+    atlas = ( SFG_FontAtlas * )calloc( sizeof( SFG_FontAtlas ), 1 );
+    if( !atlas )
+        return NULL;
+    atlas->Font = font;
+    atlas->First = first;
+    atlas->Count = count;
+    atlas->Width = width;
+    atlas->Height = height;
+    atlas->Texels = ( GLubyte * )calloc( width * height, 1 );
+    atlas->TexCoords = ( GLfloat * )malloc( count * 4 *
+                                            sizeof( GLfloat ) );
+    atlas->Boxes = ( GLfloat * )malloc( count * 4 *
+                                        sizeof( GLfloat ) );
+    if( !atlas->Texels || !atlas->TexCoords || !atlas->Boxes )
+    {
+        free( atlas->Texels );
+        free( atlas->TexCoords );
+        free( atlas->Boxes );
+        free( atlas );
+        return NULL;
+    }
+
+    x = y = 1;
+    for( c = 0; c < count; c++ )
+    {
+        const GLubyte* bits = fghGlyphBitmap( font, fghGlyph( font, first + c ),
+                                              &w, &h, origin );
+        int stride = ( w + 7 ) / 8;
+        GLfloat* tc = atlas->TexCoords + 4 * c;
+        GLfloat* box = atlas->Boxes + 4 * c;
+
+        if( x + w + 1 > width )
+        {
+            x = 1;
+            y += rowHeight + 1;
+        }
+
+        for( r = 0; r < h; r++ )
+            for( i = 0; i < w; i++ )
+                if( bits[ r * stride + i / 8 ] & ( 0x80 >> ( i % 8 ) ) )
+                    atlas->Texels[ ( y + r ) * width + x + i ] = 0xff;
+
+        tc[ 0 ] = ( GLfloat )x / width;
+        tc[ 1 ] = ( GLfloat )y / height;
+        tc[ 2 ] = ( GLfloat )( x + w ) / width;
+        tc[ 3 ] = ( GLfloat )( y + h ) / height;
+        box[ 0 ] = -origin[ 0 ];
+        box[ 1 ] = -origin[ 1 ];
+        box[ 2 ] = w - origin[ 0 ];
+        box[ 3 ] = h - origin[ 1 ];
+        x += w + 1;
+    }
+
+    fgListAppend( &fghFontAtlases, &atlas->Node );
+    return atlas;
+}
+
+/*
+ * Returns the atlas holding a character: the font's main one for its
+ * first Quantity characters and, for fonts loaded from files, one per
+ * FGH_PAGE_SIZE characters past them, made as they are used the way
+ * fghGlyph() pages their bitmaps. NULL if there is none.
+ */
+static SFG_FontAtlas* fghGlyphAtlas( const SFG_Font* font, unsigned int c )
+{
+    unsigned int first = c - c % FGH_PAGE_SIZE;
+
+    if( c < ( unsigned int )font->Quantity )
+        return fghFontAtlas( font, 0, font->Quantity );
+    if( !font->File || ( c > FGH_MAX_CHARACTER ) )
+        return NULL;
+
+    if( first < ( unsigned int )font->Quantity )
+        first = font->Quantity;
+    return fghFontAtlas( font, first,
+                         c - c % FGH_PAGE_SIZE + FGH_PAGE_SIZE - first );
+}
+
+/*
+ * Returns the atlas texture in the current window's context, uploading
+ * it the first time that context draws with the font. The caller must
+ * have saved the texture binding, as this binds the texture. Core
+ * contexts have no alpha textures, so there the texels go in the red
+ * channel.
+ */
+static GLuint fghFontTexture( SFG_Window* window, const SFG_FontAtlas* atlas )
+{
+    SFG_TextContext* context = fghTextContext( window );
+    SFG_FontTexture* texture;
+
+    for( texture = ( SFG_FontTexture * )context->FontTextures.First;
+         texture;
+         texture = ( SFG_FontTexture * )texture->Node.Next )
+        if( texture->Atlas == atlas )
+        {
+            glBindTexture( GL_TEXTURE_2D, texture->Texture );
+            return texture->Texture;
+        }
+
+    texture = ( SFG_FontTexture * )malloc( sizeof( SFG_FontTexture ) );
+    if( !texture )
+        return 0;
+    texture->Atlas = atlas;
+    glGenTextures( 1, &texture->Texture );
+    glBindTexture( GL_TEXTURE_2D, texture->Texture );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+
+    if( context->CoreText.Profile == GLUT_CORE_PROFILE )
+    {
+        GLint store[ 4 ];
+
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+
+        /* There is no glPushClientAttrib() to keep the pixel store with */
+        glGetIntegerv( GL_UNPACK_ROW_LENGTH,  store + 0 );
+        glGetIntegerv( GL_UNPACK_SKIP_ROWS,   store + 1 );
+        glGetIntegerv( GL_UNPACK_SKIP_PIXELS, store + 2 );
+        glGetIntegerv( GL_UNPACK_ALIGNMENT,   store + 3 );
+        glPixelStorei( GL_UNPACK_ROW_LENGTH,  0 );
+        glPixelStorei( GL_UNPACK_SKIP_ROWS,   0 );
+        glPixelStorei( GL_UNPACK_SKIP_PIXELS, 0 );
+        glPixelStorei( GL_UNPACK_ALIGNMENT,   1 );
+        glTexImage2D( GL_TEXTURE_2D, 0, GL_R8, atlas->Width, atlas->Height,
+                      0, GL_RED, GL_UNSIGNED_BYTE, atlas->Texels );
+        glPixelStorei( GL_UNPACK_ROW_LENGTH,  store[ 0 ] );
+        glPixelStorei( GL_UNPACK_SKIP_ROWS,   store[ 1 ] );
+        glPixelStorei( GL_UNPACK_SKIP_PIXELS, store[ 2 ] );
+        glPixelStorei( GL_UNPACK_ALIGNMENT,   store[ 3 ] );
+    }
+    else
+    {
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP );
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP );
+
+        glPushClientAttrib( GL_CLIENT_PIXEL_STORE_BIT );
+        fghSetPixelStore( );
+        glTexImage2D( GL_TEXTURE_2D, 0, GL_ALPHA, atlas->Width, atlas->Height,
+                      0, GL_ALPHA, GL_UNSIGNED_BYTE, atlas->Texels );
+        glPopClientAttrib( );
+    }
+
+    fgListAppend( &context->FontTextures, &texture->Node );
+    return texture->Texture;
+}
+
+/*
+ * Writes the quad of a glyph with the texture coordinates tc[] and the
+ * corners ( x, y ) and ( right, top ), returning the end of the quad
+ */
+static GLfloat* fghPutQuad( GLfloat* v, const GLfloat* tc, GLfloat x,
+                            GLfloat y, GLfloat right, GLfloat top )
+{
+    /* Two texture and three vertex coordinates per corner */
+    *v++ = tc[ 0 ]; *v++ = tc[ 1 ];
+    *v++ = x;       *v++ = y;      *v++ = 0.0f;
+    *v++ = tc[ 2 ]; *v++ = tc[ 1 ];
+    *v++ = right;   *v++ = y;      *v++ = 0.0f;
+    *v++ = tc[ 2 ]; *v++ = tc[ 3 ];
+    *v++ = right;   *v++ = top;    *v++ = 0.0f;
+    *v++ = tc[ 0 ]; *v++ = tc[ 3 ];
+    *v++ = x;       *v++ = top;    *v++ = 0.0f;
+    return v;
+}
+
+/*
+ * Lays a string out as quads from one of the font's atlases in
+ * fghTextBatch, in pixels from the starting raster position, and returns
+ * how many quads there are, or -1 if the batch can't grow. The inked
+ * characters the atlas doesn't hold get no quad and are counted in
+ * *outside. The raster position moves by advance[] over the string, and
+ * bounds[], if given, receives the left, bottom, right and top of the
+ * glyph bitmaps relative to the starting raster position.
+ */
+static int fghLayoutBitmapText( const SFG_Font* font,
+                                const SFG_FontAtlas* atlas,
+                                const unsigned char* string,
+                                GLfloat* advance, GLfloat* bounds,
+                                int* outside )
+{
+    const unsigned char* s;
+    GLfloat *v, x = 0.0f, y = 0.0f;
+    int quads = 0, inked = 0;
+    unsigned int c;
+
+    /* There are no more characters than bytes */
+    for( s = string; *s; s++ )
+        quads++;
+    if( quads > fghTextBatchQuads )
+    {
+        v = ( GLfloat * )realloc( fghTextBatch,
+                                  quads * 4 * 5 * sizeof( GLfloat ) );
+        if( !v )
+            return -1;
+        fghTextBatch = v;
+        fghTextBatchQuads = quads;
+    }
+
+    if( bounds )
+        bounds[ 0 ] = bounds[ 1 ] = bounds[ 2 ] = bounds[ 3 ] = 0.0f;
+    *outside = 0;
+
+    v = fghTextBatch;
+    quads = 0;
+    while( *string )
+        if( ( c = FGH_NEXT_CHARACTER( string ) ) == '\n' )
+        {
+            x = 0.0f;
+            y -= font->Height;
+        }
+        else
+        {
+            const GLubyte* face = fghGlyph( font, c );
+            GLfloat outsideBox[ 4 ];
+            const GLfloat* box = outsideBox;
+
+            if( ( c >= atlas->First ) &&
+                ( c - atlas->First < ( unsigned int )atlas->Count ) )
+                box = atlas->Boxes + 4 * ( c - atlas->First );
+            else
+            {
+                GLfloat origin[ 2 ];
+                int w, h;
+
+                fghGlyphBitmap( font, face, &w, &h, origin );
+                outsideBox[ 0 ] = -origin[ 0 ];
+                outsideBox[ 1 ] = -origin[ 1 ];
+                outsideBox[ 2 ] = w - origin[ 0 ];
+                outsideBox[ 3 ] = h - origin[ 1 ];
+            }
+
+            if( ( box[ 2 ] > box[ 0 ] ) && ( box[ 3 ] > box[ 1 ] ) )
+            {
+                GLfloat left = x + box[ 0 ], bottom = y + box[ 1 ];
+                GLfloat right = x + box[ 2 ], top = y + box[ 3 ];
+
+                if( box != outsideBox )
+                {
+                    v = fghPutQuad( v, atlas->TexCoords +
+                                       4 * ( c - atlas->First ),
+                                    left, bottom, right, top );
+                    quads++;
+                }
+                else
+                    ( *outside )++;
+
+                if( bounds && !inked++ )
+                {
+                    bounds[ 0 ] = left;  bounds[ 1 ] = bottom;
+                    bounds[ 2 ] = right; bounds[ 3 ] = top;
+                }
+                else if( bounds )
+                {
+                    if( bounds[ 0 ] > left   ) bounds[ 0 ] = left;
+                    if( bounds[ 1 ] > bottom ) bounds[ 1 ] = bottom;
+                    if( bounds[ 2 ] < right  ) bounds[ 2 ] = right;
+                    if( bounds[ 3 ] < top    ) bounds[ 3 ] = top;
+                }
+            }
+            x += face[ 0 ];
+        }
+
+    advance[ 0 ] = x;
+    advance[ 1 ] = y;
+    return quads;
+}
+
+/*
+ * Draws quads laid out by fghLayoutBitmapText() as one batch. glBitmap()
+ * places a glyph at the floor of the raster position minus the glyph
+ * origin, in window coordinates, colours it with the raster colour and
+ * advances the raster position; the quads are set up the same way and
+ * the raster position is advanced by the whole string at the end.
+ * Returns GL_FALSE, having drawn nothing, if the atlas texture could
+ * not be made or the raster colour is fully transparent.
+ */
+static GLboolean fghDrawBitmapText( const SFG_FontAtlas* atlas,
+                                    const GLfloat* vertices, int quads,
+                                    const GLfloat* advance )
+{
+    GLfloat raster[ 4 ], colour[ 4 ];
+    GLint viewport[ 4 ];
+    GLboolean valid;
+
+    /* Like glBitmap(), draw nothing from an invalid raster position */
+    glGetBooleanv( GL_CURRENT_RASTER_POSITION_VALID, &valid );
+    if( !valid )
+        return GL_TRUE;
+
+    if( quads > 0 )
+    {
+        glGetFloatv( GL_CURRENT_RASTER_POSITION, raster );
+        glGetFloatv( GL_CURRENT_RASTER_COLOR, colour );
+        glGetIntegerv( GL_VIEWPORT, viewport );
+
+        /*
+         * The texels are 0 or 1, so the modulated alpha is either zero or
+         * the raster alpha and passing "greater than zero" tests coverage
+         * alone, keeping glBitmap()'s fragment colour for blending.  A
+         * raster alpha of zero cannot carry coverage; leave that to
+         * glBitmap().
+         */
+        if( colour[ 3 ] < 1.0f / 255.0f )
+            return GL_FALSE;
+
+        glPushAttrib( GL_ENABLE_BIT | GL_TEXTURE_BIT | GL_COLOR_BUFFER_BIT |
+                      GL_CURRENT_BIT | GL_VIEWPORT_BIT | GL_TRANSFORM_BIT |
+                      GL_POLYGON_BIT );
+        if( !fghFontTexture( fgStructure.CurrentWindow, atlas ) )
+        {
+            glPopAttrib( );
+            return GL_FALSE;
+        }
+        glPushClientAttrib( GL_CLIENT_VERTEX_ARRAY_BIT );
+
+        glDisable( GL_LIGHTING );
+        glDisable( GL_CULL_FACE );
+        glDisable( GL_TEXTURE_GEN_S );
+        glDisable( GL_TEXTURE_GEN_T );
+        glEnable( GL_TEXTURE_2D );
+        glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+        glEnable( GL_ALPHA_TEST );
+        glAlphaFunc( GL_GREATER, 0.0f );
+        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+        glColor4fv( colour );
+        glDepthRange( 0.0, 1.0 );
+
+        /* Map vertices straight to window coordinates and depth */
+        glMatrixMode( GL_TEXTURE );
+        glPushMatrix( );
+        glLoadIdentity( );
+        glMatrixMode( GL_PROJECTION );
+        glPushMatrix( );
+        glLoadIdentity( );
+        glOrtho( viewport[ 0 ], viewport[ 0 ] + viewport[ 2 ],
+                 viewport[ 1 ], viewport[ 1 ] + viewport[ 3 ], 0.0, 1.0 );
+        glMatrixMode( GL_MODELVIEW );
+        glPushMatrix( );
+        glLoadIdentity( );
+        glTranslatef( ( GLfloat )floor( raster[ 0 ] ),
+                      ( GLfloat )floor( raster[ 1 ] ), -raster[ 2 ] );
+
+        glInterleavedArrays( GL_T2F_V3F, 0, vertices );
+        glDrawArrays( GL_QUADS, 0, quads * 4 );
+
+        glPopMatrix( );
+        glMatrixMode( GL_PROJECTION );
+        glPopMatrix( );
+        glMatrixMode( GL_TEXTURE );
+        glPopMatrix( );
+
+        glPopClientAttrib( );
+        glPopAttrib( );
+    }
+
+    /* Leave the raster position where the last glBitmap() would have */
+    glBitmap( 0, 0, 0.0f, 0.0f, advance[ 0 ], advance[ 1 ], NULL );
+    return GL_TRUE;
+}
+
+/*
+ * Draws a string from the font's atlas. Returns GL_FALSE if the string
+ * must be drawn with glBitmap() instead.
+ */
+static GLboolean fghBitmapStringAtlas( const SFG_Font* font,
+                                       const unsigned char* string )
+{
+    SFG_FontAtlas* atlas;
+    GLfloat advance[ 2 ];
+    int quads, outside;
+
+    if( !fgStructure.CurrentWindow )
+        return GL_FALSE;
+    atlas = fghFontAtlas( font, 0, font->Quantity );
+    if( !atlas )
+        return GL_FALSE;
+    quads = fghLayoutBitmapText( font, atlas, string, advance, NULL,
+                                 &outside );
+    if( ( quads < 0 ) || outside )
+        return GL_FALSE;
+
+    return fghDrawBitmapText( atlas, fghTextBatch, quads, advance );
+}
+
+/*
+ * Frees the bitmap font atlases and the string batch
+ */
+void fgDestroyFontAtlases( void )
+{
+    SFG_FontAtlas* atlas;
+
+    while( ( atlas = ( SFG_FontAtlas * )fghFontAtlases.First ) )
+    {
+        fgListRemove( &fghFontAtlases, &atlas->Node );
+        free( atlas->Texels );
+        free( atlas->TexCoords );
+        free( atlas->Boxes );
+        free( atlas );
+    }
+
+    free( fghTextBatch );
+    fghTextBatch = NULL;
+    fghTextBatchQuads = 0;
+}
+
+/*
+ * Returns the length of the longest line of a string in a stroke font,
+ * from string up to end, or to the NUL if end is NULL. The ASCII
+ * characters, which are all in the stroke fonts, are added straight
+ * from the font's advance table; a float sum can't be reordered, so
+ * unlike fghBitmapLength() there is nothing to gain from finding the
+ * runs first.
+ */
+static GLfloat fghStrokeLength( const SFG_StrokeFont* font,
+                                const unsigned char* string,
+                                const unsigned char* end )
+{
+    GLfloat length = 0.0, this_line_length = 0.0;
+
+    while( end ? ( string < end ) : ( *string != '\0' ) )
+    {
+        unsigned int c = *string;
+
+        if( ( c < 0x80 ) && ( c != '\n' ) )
+        {
+            this_line_length += font->Right[ c ];
+            string++;
+        }
+        else if( c == '\n' )  /* EOL; reset the length of this line */
+        {
+            if( length < this_line_length )
+                length = this_line_length;
+            this_line_length = 0.0;
+            string++;
+        }
+        else if( ( c = fghNextCharacterN( &string, end ) ) <
+                 ( unsigned int )font->Quantity )
+            this_line_length += font->Right[ c ];
+    }
+    if( length < this_line_length )
+        length = this_line_length;
+
+    return length;
+}
+
+/*
+ * The batch glutStrokeString() assembles a whole string's strips in
+ */
+static SFG_StrokeArrays fghStrokeBatch;
+static int              fghStrokeBatchVertices = 0;
+static int              fghStrokeBatchStrips = 0;
+
+/*
+ * glMultiDrawArrays() is OpenGL 1.4, so it is looked up the first time
+ * it is needed and emulated with glDrawArrays() where it is missing
+ */
+typedef void (APIENTRY *FGH_MultiDrawArraysProc)( GLenum mode,
+    const GLint* first, const GLsizei* count, GLsizei primcount );
+static FGH_MultiDrawArraysProc fghMultiDrawArraysProc = NULL;
+static GLboolean               fghMultiDrawArraysChecked = GL_FALSE;
+
+static void fghMultiDrawArrays( GLenum mode, const GLint* first,
+                                const GLsizei* count, GLsizei primcount )
+{
+    if( !fghMultiDrawArraysChecked )
+    {
+        const char* version = ( const char * )glGetString( GL_VERSION );
+        int major = 0, minor = 0;
+
+        if( version && ( sscanf( version, "%d.%d", &major, &minor ) == 2 ) &&
+            ( ( major > 1 ) || ( minor >= 4 ) ) )
+            fghMultiDrawArraysProc = ( FGH_MultiDrawArraysProc )
+                fghGetProcAddress( "glMultiDrawArrays" );
+        fghMultiDrawArraysChecked = GL_TRUE;
+    }
+
+    if( fghMultiDrawArraysProc )
+        fghMultiDrawArraysProc( mode, first, count, primcount );
+    else
+        while( primcount-- > 0 )
+            glDrawArrays( mode, *first++, *count++ );
+}
+
+/*
+ * Makes room for a string's worth of strips in the string batch
+ */
+static void fghReserveStrokeBatch( int numVertices, int numStrips )
+{
+    if( numVertices > fghStrokeBatchVertices )
+    {
+        fghStrokeBatch.Vertices = ( GLfloat * )realloc(
+            fghStrokeBatch.Vertices, 2 * numVertices * sizeof( GLfloat ) );
+        if( !fghStrokeBatch.Vertices )
+            fgError( "Failed to allocate memory in fghReserveStrokeBatch" );
+        fghStrokeBatchVertices = numVertices;
+    }
+    if( numStrips > fghStrokeBatchStrips )
+    {
+        fghStrokeBatch.First = ( GLint * )realloc(
+            fghStrokeBatch.First, numStrips * sizeof( GLint ) );
+        fghStrokeBatch.Count = ( GLsizei * )realloc(
+            fghStrokeBatch.Count, numStrips * sizeof( GLsizei ) );
+        if( !fghStrokeBatch.First || !fghStrokeBatch.Count )
+            fgError( "Failed to allocate memory in fghReserveStrokeBatch" );
+        fghStrokeBatchStrips = numStrips;
+    }
+}
+
+/*
+ * Lays a string out in the string batch, copying each character's strips
+ * in at the pen position, and returns the number of strips. The pen moves
+ * by advance[] over the string, and bounds[], if given, receives the
+ * left, bottom, right and top of the strokes relative to the start.
+ */
+static int fghLayoutStrokeText( const SFG_StrokeFont* font,
+                                const unsigned char* string,
+                                GLfloat* advance, GLfloat* bounds )
+{
+    const unsigned char* s = string;
+    unsigned int c;
+    int numVertices = 0, numStrips = 0;
+    GLfloat *v, x = 0.0f, y = 0.0f;
+
+    while( *s )
+        if( ( c = FGH_NEXT_CHARACTER( s ) ) < ( unsigned int )font->Quantity )
+        {
+            int first = font->FirstStrip[ c ];
+            int last = font->FirstStrip[ c + 1 ];
+
+            numStrips += last - first;
+            if( last > first )
+                numVertices += font->First[ last - 1 ] +
+                               font->Count[ last - 1 ] -
+                               font->First[ first ];
+        }
+    fghReserveStrokeBatch( numVertices, numStrips );
+
+    /*
+     * Step through the string, copying each character's strips into the
+     * batch. A newline will simply move the pen back to the start of the
+     * line and down one line.
+     */
+    v = fghStrokeBatch.Vertices;
+    numVertices = numStrips = 0;
+    while( *string )
+        if( ( c = FGH_NEXT_CHARACTER( string ) ) <
+            ( unsigned int )font->Quantity )
+        {
+            if( c == '\n' )
+            {
+                x = 0.0f;
+                y -= font->Height;
+            }
+            else  /* Not an EOL, add the stroke character */
+            {
+                int j, strip;
+
+                for( strip = font->FirstStrip[ c ];
+                     strip < font->FirstStrip[ c + 1 ];
+                     strip++, numStrips++ )
+                {
+                    const GLfloat* from =
+                        font->Vertices + 2 * font->First[ strip ];
+
+                    fghStrokeBatch.First[ numStrips ] = numVertices;
+                    fghStrokeBatch.Count[ numStrips ] = font->Count[ strip ];
+                    for( j = 0; j < font->Count[ strip ]; j++ )
+                    {
+                        *v++ = *from++ + x;
+                        *v++ = *from++ + y;
+                    }
+                    numVertices += font->Count[ strip ];
+                }
+
+                x += font->Right[ c ];
+            }
+        }
+
+    if( bounds )
+    {
+        int i;
+
+        bounds[ 0 ] = bounds[ 1 ] = bounds[ 2 ] = bounds[ 3 ] = 0.0f;
+        for( i = 0, v = fghStrokeBatch.Vertices; i < numVertices; i++, v += 2 )
+        {
+            if( !i || ( bounds[ 0 ] > v[ 0 ] ) ) bounds[ 0 ] = v[ 0 ];
+            if( !i || ( bounds[ 1 ] > v[ 1 ] ) ) bounds[ 1 ] = v[ 1 ];
+            if( !i || ( bounds[ 2 ] < v[ 0 ] ) ) bounds[ 2 ] = v[ 0 ];
+            if( !i || ( bounds[ 3 ] < v[ 1 ] ) ) bounds[ 3 ] = v[ 1 ];
+        }
+    }
+    advance[ 0 ] = x;
+    advance[ 1 ] = y;
+    return numStrips;
+}
+
+/*
+ * Draws strips laid out by fghLayoutStrokeText() with one call, then
+ * leaves the modelview matrix where per-character steps would have
+ */
+static void fghDrawStrokeText( const GLfloat* vertices, const GLint* first,
+                               const GLsizei* count, int numStrips,
+                               const GLfloat* advance )
+{
+    if( numStrips > 0 )
+    {
+        glPushClientAttrib( GL_CLIENT_VERTEX_ARRAY_BIT );
+        glInterleavedArrays( GL_V2F, 0, vertices );
+        fghMultiDrawArrays( GL_LINE_STRIP, first, count, numStrips );
+        glPopClientAttrib( );
+    }
+
+    glTranslatef( advance[ 0 ], advance[ 1 ], 0.0 );
+}
+
+/*
+ * Frees the string batch
+ */
+void fgDestroyStrokeArrays( void )
+{
+    free( fghStrokeBatch.Vertices );
+    free( fghStrokeBatch.First );
+    free( fghStrokeBatch.Count );
+    memset( &fghStrokeBatch, 0, sizeof( fghStrokeBatch ) );
+    fghStrokeBatchVertices = fghStrokeBatchStrips = 0;
+
+    fghMultiDrawArraysProc = NULL;
+    fghMultiDrawArraysChecked = GL_FALSE;
+}
+
+/*
+ * Core profile contexts have neither glBitmap() nor the fixed function
+ * pipeline, so there text is drawn with a small shader program: bitmap
+ * strings as quads from the font's atlas and stroke strings as line
+ * strips, each streamed into a buffer and drawn with a single call.
+ * These are the entry points it needs past OpenGL 1.1.
+ */
+typedef char      FGH_GLchar;
+typedef ptrdiff_t FGH_GLsizeiptr;
+
+typedef GLuint (APIENTRY *FGH_CreateShaderProc)( GLenum type );
+typedef void   (APIENTRY *FGH_ShaderSourceProc)( GLuint shader, GLsizei count,
+    const FGH_GLchar** string, const GLint* length );
+typedef void   (APIENTRY *FGH_CompileShaderProc)( GLuint shader );
+typedef void   (APIENTRY *FGH_GetShaderivProc)( GLuint shader, GLenum pname,
+    GLint* params );
+typedef void   (APIENTRY *FGH_DeleteShaderProc)( GLuint shader );
+typedef GLuint (APIENTRY *FGH_CreateProgramProc)( void );
+typedef void   (APIENTRY *FGH_AttachShaderProc)( GLuint program, GLuint shader );
+typedef void   (APIENTRY *FGH_BindAttribLocationProc)( GLuint program,
+    GLuint index, const FGH_GLchar* name );
+typedef void   (APIENTRY *FGH_LinkProgramProc)( GLuint program );
+typedef void   (APIENTRY *FGH_GetProgramivProc)( GLuint program, GLenum pname,
+    GLint* params );
+typedef void   (APIENTRY *FGH_DeleteProgramProc)( GLuint program );
+typedef GLint  (APIENTRY *FGH_GetUniformLocationProc)( GLuint program,
+    const FGH_GLchar* name );
+typedef void   (APIENTRY *FGH_UseProgramProc)( GLuint program );
+typedef void   (APIENTRY *FGH_Uniform1iProc)( GLint location, GLint v0 );
+typedef void   (APIENTRY *FGH_Uniform4fvProc)( GLint location, GLsizei count,
+    const GLfloat* value );
+typedef void   (APIENTRY *FGH_GenVertexArraysProc)( GLsizei n, GLuint* arrays );
+typedef void   (APIENTRY *FGH_BindVertexArrayProc)( GLuint array );
+typedef void   (APIENTRY *FGH_DeleteVertexArraysProc)( GLsizei n,
+    const GLuint* arrays );
+typedef void   (APIENTRY *FGH_GenBuffersProc)( GLsizei n, GLuint* buffers );
+typedef void   (APIENTRY *FGH_DeleteBuffersProc)( GLsizei n,
+    const GLuint* buffers );
+typedef void   (APIENTRY *FGH_BindBufferProc)( GLenum target, GLuint buffer );
+typedef void   (APIENTRY *FGH_BufferDataProc)( GLenum target,
+    FGH_GLsizeiptr size, const GLvoid* data, GLenum usage );
+typedef void   (APIENTRY *FGH_VertexAttribPointerProc)( GLuint index,
+    GLint size, GLenum type, GLboolean normalized, GLsizei stride,
+    const GLvoid* pointer );
+typedef void   (APIENTRY *FGH_EnableVertexAttribArrayProc)( GLuint index );
+typedef void   (APIENTRY *FGH_DisableVertexAttribArrayProc)( GLuint index );
+typedef void   (APIENTRY *FGH_ActiveTextureProc)( GLenum texture );
+
+static struct
+{
+    GLboolean                        Checked;
+    GLboolean                        Loaded;
+    FGH_CreateShaderProc             CreateShader;
+    FGH_ShaderSourceProc             ShaderSource;
+    FGH_CompileShaderProc            CompileShader;
+    FGH_GetShaderivProc              GetShaderiv;
+    FGH_DeleteShaderProc             DeleteShader;
+    FGH_CreateProgramProc            CreateProgram;
+    FGH_AttachShaderProc             AttachShader;
+    FGH_BindAttribLocationProc       BindAttribLocation;
+    FGH_LinkProgramProc              LinkProgram;
+    FGH_GetProgramivProc             GetProgramiv;
+    FGH_DeleteProgramProc            DeleteProgram;
+    FGH_GetUniformLocationProc       GetUniformLocation;
+    FGH_UseProgramProc               UseProgram;
+    FGH_Uniform1iProc                Uniform1i;
+    FGH_Uniform4fvProc               Uniform4fv;
+    FGH_GenVertexArraysProc          GenVertexArrays;
+    FGH_BindVertexArrayProc          BindVertexArray;
+    FGH_DeleteVertexArraysProc       DeleteVertexArrays;
+    FGH_GenBuffersProc               GenBuffers;
+    FGH_DeleteBuffersProc            DeleteBuffers;
+    FGH_BindBufferProc               BindBuffer;
+    FGH_BufferDataProc               BufferData;
+    FGH_VertexAttribPointerProc      VertexAttribPointer;
+    FGH_EnableVertexAttribArrayProc  EnableVertexAttribArray;
+    FGH_DisableVertexAttribArrayProc DisableVertexAttribArray;
+    FGH_ActiveTextureProc            ActiveTexture;
+} fghCoreGL;
+
+#define FGH_GET_PROC( proc ) \
+    ( ( fghCoreGL.proc = ( FGH_ ## proc ## Proc ) \
+        fghGetProcAddress( "gl" #proc ) ) != NULL )
+
+/*
+ * The text program. Positions are scaled and offset into clip space by
+ * fg_Transform; atlas texels below one half are left out like the unset
+ * bits of a glBitmap() are.
+ */
+static const char* fghCoreTextVertexShader =
+    "in vec4 fg_Vertex;\n"
+    "in vec2 fg_TexCoord;\n"
+    "uniform vec4 fg_Transform;\n"
+    "out vec2 texCoord;\n"
+    "void main( void )\n"
+    "{\n"
+    "    texCoord = fg_TexCoord;\n"
+    "    gl_Position = vec4( fg_Vertex.xy * fg_Transform.xy +\n"
+    "                        fg_Transform.zw, 0.0, 1.0 );\n"
+    "}\n";
+
+static const char* fghCoreTextFragmentShader =
+    "uniform vec4 fg_Color;\n"
+    "uniform sampler2D fg_Atlas;\n"
+    "uniform bool fg_Textured;\n"
+    "in vec2 texCoord;\n"
+    "out vec4 fragColor;\n"
+    "void main( void )\n"
+    "{\n"
+    "    if( fg_Textured && ( texture( fg_Atlas, texCoord ).r < 0.5 ) )\n"
+    "        discard;\n"
+    "    fragColor = fg_Color;\n"
+    "}\n";
+
+/*
+ * Where the next core profile string starts, the colour text is drawn
+ * in, and the scale and offset of the orthographic transform taking
+ * text coordinates to clip space, see glutTextOrtho(). A zero scale
+ * stands for one unit per pixel of the viewport.
+ */
+static GLfloat fghTextPosition[ 2 ] = { 0.0f, 0.0f };
+static GLfloat fghTextColor[ 4 ] = { 1.0f, 1.0f, 1.0f, 1.0f };
+static GLfloat fghTextOrtho[ 4 ] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+/*
+ * Returns the current window if its context is a core profile one, in
+ * which text has to be drawn by the functions below. Forward compatible
+ * contexts lack the fixed function pipeline too.
+ */
+static SFG_Window* fghCoreTextWindow( void )
+{
+    SFG_Window* window = fgStructure.CurrentWindow;
+    SFG_CoreText* text;
+
+    if( !window )
+        return NULL;
+
+    text = &fghTextContext( window )->CoreText;
+    if( !text->Profile )
+    {
+        const char* version = ( const char * )glGetString( GL_VERSION );
+        int major = 0, minor = 0;
+        GLint flags = 0, mask = 0;
+
+        /* Older contexts don't know these queries */
+        if( version && ( sscanf( version, "%d.%d", &major, &minor ) == 2 ) &&
+            ( major >= 3 ) )
+        {
+            glGetIntegerv( GL_CONTEXT_FLAGS, &flags );
+            if( ( major > 3 ) || ( minor >= 2 ) )
+                glGetIntegerv( GL_CONTEXT_PROFILE_MASK, &mask );
+        }
+
+        if( ( mask & GL_CONTEXT_CORE_PROFILE_BIT ) ||
+            ( flags & GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT ) )
+            text->Profile = GLUT_CORE_PROFILE;
+        else
+            text->Profile = GLUT_COMPATIBILITY_PROFILE;
+    }
+
+    return ( text->Profile == GLUT_CORE_PROFILE ) ? window : NULL;
+}
+
+/*
+ * Compiles one of the text shaders, returning 0 if that fails
+ */
+static GLuint fghCoreTextShader( GLenum type, const char* version,
+                                 const char* source )
+{
+    const FGH_GLchar* sources[ 2 ];
+    GLuint shader = fghCoreGL.CreateShader( type );
+    GLint compiled = GL_FALSE;
+
+    sources[ 0 ] = version;
+    sources[ 1 ] = source;
+    fghCoreGL.ShaderSource( shader, 2, sources, NULL );
+    fghCoreGL.CompileShader( shader );
+    fghCoreGL.GetShaderiv( shader, GL_COMPILE_STATUS, &compiled );
+    if( !compiled )
+    {
+        fghCoreGL.DeleteShader( shader );
+        return 0;
+    }
+    return shader;
+}
+
+/*
+ * Makes the text program and buffers in a window's context, the first
+ * time that context draws text. Returns GL_FALSE if they can't be made, warning
+ * about it only once.
+ */
+static GLboolean fghCoreTextSetup( SFG_Window* window )
+{
+    SFG_CoreText* text = &fghTextContext( window )->CoreText;
+    const char* version = ( const char * )glGetString( GL_VERSION );
+    const char* glsl = "#version 130\n";
+    GLuint vertexShader, fragmentShader;
+    GLint linked = GL_FALSE, program, vertexArray;
+    int major = 0, minor = 0;
+
+    if( text->Program )
+        return GL_TRUE;
+    if( text->Failed )
+        return GL_FALSE;
+    text->Failed = GL_TRUE;
+
+    if( !fghCoreGL.Checked )
+    {
+        fghCoreGL.Loaded = FGH_GET_PROC( CreateShader ) &&
+                           FGH_GET_PROC( ShaderSource ) &&
+                           FGH_GET_PROC( CompileShader ) &&
+                           FGH_GET_PROC( GetShaderiv ) &&
+                           FGH_GET_PROC( DeleteShader ) &&
+                           FGH_GET_PROC( CreateProgram ) &&
+                           FGH_GET_PROC( AttachShader ) &&
+                           FGH_GET_PROC( BindAttribLocation ) &&
+                           FGH_GET_PROC( LinkProgram ) &&
+                           FGH_GET_PROC( GetProgramiv ) &&
+                           FGH_GET_PROC( DeleteProgram ) &&
+                           FGH_GET_PROC( GetUniformLocation ) &&
+                           FGH_GET_PROC( UseProgram ) &&
+                           FGH_GET_PROC( Uniform1i ) &&
+                           FGH_GET_PROC( Uniform4fv ) &&
+                           FGH_GET_PROC( GenVertexArrays ) &&
+                           FGH_GET_PROC( BindVertexArray ) &&
+                           FGH_GET_PROC( DeleteVertexArrays ) &&
+                           FGH_GET_PROC( GenBuffers ) &&
+                           FGH_GET_PROC( DeleteBuffers ) &&
+                           FGH_GET_PROC( BindBuffer ) &&
+                           FGH_GET_PROC( BufferData ) &&
+                           FGH_GET_PROC( VertexAttribPointer ) &&
+                           FGH_GET_PROC( EnableVertexAttribArray ) &&
+                           FGH_GET_PROC( DisableVertexAttribArray ) &&
+                           FGH_GET_PROC( ActiveTexture );
+        fghCoreGL.Checked = GL_TRUE;
+    }
+    if( !fghCoreGL.Loaded )
+    {
+        fgWarning( "Core profile text needs OpenGL 3.0 entry points, "
+                   "which are missing" );
+        return GL_FALSE;
+    }
+
+    /* OpenGL 3.2 core contexts need not take GLSL 1.30 any more */
+    if( version && ( sscanf( version, "%d.%d", &major, &minor ) == 2 ) &&
+        ( ( major > 3 ) || ( minor >= 2 ) ) )
+        glsl = "#version 150\n";
+
+    vertexShader = fghCoreTextShader( GL_VERTEX_SHADER, glsl,
+                                      fghCoreTextVertexShader );
+    fragmentShader = fghCoreTextShader( GL_FRAGMENT_SHADER, glsl,
+                                        fghCoreTextFragmentShader );
+    if( vertexShader && fragmentShader )
+    {
+        text->Program = fghCoreGL.CreateProgram( );
+        fghCoreGL.AttachShader( text->Program, vertexShader );
+        fghCoreGL.AttachShader( text->Program, fragmentShader );
+        fghCoreGL.BindAttribLocation( text->Program, 0, "fg_Vertex" );
+        fghCoreGL.BindAttribLocation( text->Program, 1, "fg_TexCoord" );
+        fghCoreGL.LinkProgram( text->Program );
+        fghCoreGL.GetProgramiv( text->Program, GL_LINK_STATUS, &linked );
+    }
+
+    /* The program keeps the shaders as long as it needs them */
+    if( vertexShader )
+        fghCoreGL.DeleteShader( vertexShader );
+    if( fragmentShader )
+        fghCoreGL.DeleteShader( fragmentShader );
+    if( !linked )
+    {
+        if( text->Program )
+            fghCoreGL.DeleteProgram( text->Program );
+        text->Program = 0;
+        fgWarning( "Failed to build the core profile text program" );
+        return GL_FALSE;
+    }
+
+    text->TransformLocation =
+        fghCoreGL.GetUniformLocation( text->Program, "fg_Transform" );
+    text->ColorLocation =
+        fghCoreGL.GetUniformLocation( text->Program, "fg_Color" );
+    text->TexturedLocation =
+        fghCoreGL.GetUniformLocation( text->Program, "fg_Textured" );
+
+    glGetIntegerv( GL_CURRENT_PROGRAM, &program );
+    fghCoreGL.UseProgram( text->Program );
+    fghCoreGL.Uniform1i(
+        fghCoreGL.GetUniformLocation( text->Program, "fg_Atlas" ), 0 );
+    fghCoreGL.UseProgram( program );
+
+    /* The index buffer stays bound to the vertex array object */
+    glGetIntegerv( GL_VERTEX_ARRAY_BINDING, &vertexArray );
+    fghCoreGL.GenVertexArrays( 1, &text->VertexArray );
+    fghCoreGL.GenBuffers( 1, &text->Buffer );
+    fghCoreGL.GenBuffers( 1, &text->IndexBuffer );
+    fghCoreGL.BindVertexArray( text->VertexArray );
+    fghCoreGL.BindBuffer( GL_ELEMENT_ARRAY_BUFFER, text->IndexBuffer );
+    fghCoreGL.BindVertexArray( vertexArray );
+
+    text->Failed = GL_FALSE;
+    return GL_TRUE;
+}
+
+/*
+ * Draws text with the program of fghCoreTextSetup(), putting back the
+ * bindings it changes. Given an atlas, the vertices are quads laid out
+ * by fghLayoutBitmapText(); otherwise they are stroke strips laid out
+ * by fghLayoutStrokeText(). transform[] scales and then offsets their
+ * coordinates into clip space.
+ */
+static void fghDrawCoreText( SFG_Window* window, const GLfloat* transform,
+                             const SFG_FontAtlas* atlas,
+                             const GLfloat* vertices, int quads,
+                             const GLint* first, const GLsizei* count,
+                             int numStrips )
+{
+    SFG_CoreText* text = &fghTextContext( window )->CoreText;
+    GLint program, vertexArray, buffer;
+
+    glGetIntegerv( GL_CURRENT_PROGRAM, &program );
+    glGetIntegerv( GL_VERTEX_ARRAY_BINDING, &vertexArray );
+    glGetIntegerv( GL_ARRAY_BUFFER_BINDING, &buffer );
+
+    fghCoreGL.UseProgram( text->Program );
+    fghCoreGL.Uniform4fv( text->TransformLocation, 1, transform );
+    fghCoreGL.Uniform4fv( text->ColorLocation, 1, fghTextColor );
+    fghCoreGL.Uniform1i( text->TexturedLocation, atlas != NULL );
+    fghCoreGL.BindVertexArray( text->VertexArray );
+    fghCoreGL.BindBuffer( GL_ARRAY_BUFFER, text->Buffer );
+
+    if( atlas )
+    {
+        GLint texture, unit;
+        GLboolean cullFace = glIsEnabled( GL_CULL_FACE );
+
+        glGetIntegerv( GL_ACTIVE_TEXTURE, &unit );
+        fghCoreGL.ActiveTexture( GL_TEXTURE0 );
+        glGetIntegerv( GL_TEXTURE_BINDING_2D, &texture );
+
+        if( fghFontTexture( window, atlas ) )
+        {
+            if( quads > text->NumIndexedQuads )
+            {
+                GLuint* indices = ( GLuint * )malloc( quads * 6 *
+                                                      sizeof( GLuint ) );
+                int i;
+
+                if( !indices )
+                    fgError( "Failed to allocate memory in fghDrawCoreText" );
+                for( i = 0; i < quads; i++ )
+                {
+                    indices[ 6 * i + 0 ] = 4 * i + 0;
+                    indices[ 6 * i + 1 ] = 4 * i + 1;
+                    indices[ 6 * i + 2 ] = 4 * i + 2;
+                    indices[ 6 * i + 3 ] = 4 * i + 0;
+                    indices[ 6 * i + 4 ] = 4 * i + 2;
+                    indices[ 6 * i + 5 ] = 4 * i + 3;
+                }
+                fghCoreGL.BufferData( GL_ELEMENT_ARRAY_BUFFER,
+                                      quads * 6 * sizeof( GLuint ), indices,
+                                      GL_STATIC_DRAW );
+                free( indices );
+                text->NumIndexedQuads = quads;
+            }
+
+            fghCoreGL.BufferData( GL_ARRAY_BUFFER,
+                                  quads * 4 * 5 * sizeof( GLfloat ),
+                                  vertices, GL_STREAM_DRAW );
+            fghCoreGL.VertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE,
+                                           5 * sizeof( GLfloat ),
+                                           ( GLvoid * )( 2 * sizeof( GLfloat ) ) );
+            fghCoreGL.VertexAttribPointer( 1, 2, GL_FLOAT, GL_FALSE,
+                                           5 * sizeof( GLfloat ), NULL );
+            fghCoreGL.EnableVertexAttribArray( 0 );
+            fghCoreGL.EnableVertexAttribArray( 1 );
+
+            glDisable( GL_CULL_FACE );
+            glDrawElements( GL_TRIANGLES, quads * 6, GL_UNSIGNED_INT, NULL );
+            if( cullFace )
+                glEnable( GL_CULL_FACE );
+        }
+
+        glBindTexture( GL_TEXTURE_2D, texture );
+        fghCoreGL.ActiveTexture( unit );
+    }
+    else
+    {
+        fghCoreGL.BufferData( GL_ARRAY_BUFFER,
+                              2 * ( first[ numStrips - 1 ] +
+                                    count[ numStrips - 1 ] ) *
+                              sizeof( GLfloat ),
+                              vertices, GL_STREAM_DRAW );
+        fghCoreGL.VertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, 0, NULL );
+        fghCoreGL.EnableVertexAttribArray( 0 );
+        fghCoreGL.DisableVertexAttribArray( 1 );
+        fghMultiDrawArrays( GL_LINE_STRIP, first, count, numStrips );
+    }
+
+    fghCoreGL.BindBuffer( GL_ARRAY_BUFFER, buffer );
+    fghCoreGL.BindVertexArray( vertexArray );
+    fghCoreGL.UseProgram( program );
+}
+
+/*
+ * Gets the viewport and the scale and offset of the text transform.
+ * Returns GL_FALSE for an empty viewport, which nothing can be drawn in.
+ */
+static GLboolean fghCoreTextTransform( GLint* viewport, GLfloat* ortho )
+{
+    glGetIntegerv( GL_VIEWPORT, viewport );
+    if( ( viewport[ 2 ] <= 0 ) || ( viewport[ 3 ] <= 0 ) )
+        return GL_FALSE;
+
+    if( fghTextOrtho[ 0 ] != 0.0f )
+        memcpy( ortho, fghTextOrtho, 4 * sizeof( GLfloat ) );
+    else
+    {
+        ortho[ 0 ] = 2.0f / viewport[ 2 ];
+        ortho[ 1 ] = 2.0f / viewport[ 3 ];
+        ortho[ 2 ] = ortho[ 3 ] = -1.0f;
+    }
+    return GL_TRUE;
+}
+
+/*
+ * Draws quads laid out by fghLayoutBitmapText() at the text position.
+ * Like glBitmap(), the glyphs go at whole pixels less their origins,
+ * and the position moves on by the advance[] in pixels.
+ */
+static void fghCoreBitmapText( SFG_Window* window, const SFG_FontAtlas* atlas,
+                               const GLfloat* vertices, int quads,
+                               const GLfloat* advance )
+{
+    GLfloat ortho[ 4 ], transform[ 4 ];
+    GLint viewport[ 4 ];
+
+    if( !fghCoreTextTransform( viewport, ortho ) )
+        return;
+
+    if( ( quads > 0 ) && fghCoreTextSetup( window ) )
+    {
+        /* The text position in pixels from the viewport's corner */
+        GLfloat x = ( fghTextPosition[ 0 ] * ortho[ 0 ] + ortho[ 2 ] + 1.0f ) *
+                    viewport[ 2 ] / 2.0f;
+        GLfloat y = ( fghTextPosition[ 1 ] * ortho[ 1 ] + ortho[ 3 ] + 1.0f ) *
+                    viewport[ 3 ] / 2.0f;
+
+        transform[ 0 ] = 2.0f / viewport[ 2 ];
+        transform[ 1 ] = 2.0f / viewport[ 3 ];
+        transform[ 2 ] = ( GLfloat )floor( x ) * transform[ 0 ] - 1.0f;
+        transform[ 3 ] = ( GLfloat )floor( y ) * transform[ 1 ] - 1.0f;
+        fghDrawCoreText( window, transform, atlas, vertices, quads,
+                         NULL, NULL, 0 );
+    }
+
+    fghTextPosition[ 0 ] += advance[ 0 ] * 2.0f / ( viewport[ 2 ] * ortho[ 0 ] );
+    fghTextPosition[ 1 ] += advance[ 1 ] * 2.0f / ( viewport[ 3 ] * ortho[ 1 ] );
+}
+
+/*
+ * Draws a string of a bitmap font from its atlases. The characters past
+ * the font's first Quantity come from page atlases, a batch per page the
+ * string uses, drawn without moving the text position; the main atlas
+ * batch then moves it on past the whole string.
+ */
+static void fghCoreBitmapString( SFG_Window* window, const SFG_Font* font,
+                                 const unsigned char* string )
+{
+    SFG_FontAtlas* atlas;
+    GLfloat advance[ 2 ], still[ 2 ];
+    unsigned int from = font->Quantity, next, c;
+    const unsigned char* s;
+    int quads, outside;
+
+    still[ 0 ] = still[ 1 ] = 0.0f;
+
+    /* Built-in fonts have nothing past their Quantity to draw */
+    while( font->File )
+    {
+        for( s = string, next = FGH_MAX_CHARACTER + 1; *s; )
+            if( ( ( c = FGH_NEXT_CHARACTER( s ) ) >= from ) && ( c < next ) )
+                next = c;
+        if( next > FGH_MAX_CHARACTER )
+            break;
+
+        atlas = fghGlyphAtlas( font, next );
+        if( !atlas )
+            break;
+        quads = fghLayoutBitmapText( font, atlas, string, advance, NULL,
+                                     &outside );
+        if( quads > 0 )
+            fghCoreBitmapText( window, atlas, fghTextBatch, quads, still );
+        from = atlas->First + atlas->Count;
+    }
+
+    atlas = fghFontAtlas( font, 0, font->Quantity );
+    if( !atlas )
+        return;
+    quads = fghLayoutBitmapText( font, atlas, string, advance, NULL,
+                                 &outside );
+    if( quads >= 0 )
+        fghCoreBitmapText( window, atlas, fghTextBatch, quads, advance );
+}
+
+/*
+ * Draws strips laid out by fghLayoutStrokeText() at the text position,
+ * in text coordinates, and moves the position on past them
+ */
+static void fghCoreStrokeText( SFG_Window* window, const GLfloat* vertices,
+                               const GLint* first, const GLsizei* count,
+                               int numStrips, const GLfloat* advance )
+{
+    GLfloat ortho[ 4 ], transform[ 4 ];
+    GLint viewport[ 4 ];
+
+    if( !fghCoreTextTransform( viewport, ortho ) )
+        return;
+
+    if( ( numStrips > 0 ) && fghCoreTextSetup( window ) )
+    {
+        transform[ 0 ] = ortho[ 0 ];
+        transform[ 1 ] = ortho[ 1 ];
+        transform[ 2 ] = fghTextPosition[ 0 ] * ortho[ 0 ] + ortho[ 2 ];
+        transform[ 3 ] = fghTextPosition[ 1 ] * ortho[ 1 ] + ortho[ 3 ];
+        fghDrawCoreText( window, transform, NULL, vertices, 0,
+                         first, count, numStrips );
+    }
+
+    fghTextPosition[ 0 ] += advance[ 0 ];
+    fghTextPosition[ 1 ] += advance[ 1 ];
+}
+
+/*
+ * Frees a context's text state, having deleted its GL objects first if
+ * deleteObjects is set, with the context current
+ */
+static void fghFreeTextContext( SFG_TextContext* text,
+                                GLboolean deleteObjects )
+{
+    SFG_FontTexture* texture;
+
+    while( ( texture = ( SFG_FontTexture * )text->FontTextures.First ) )
+    {
+        if( deleteObjects )
+            glDeleteTextures( 1, &texture->Texture );
+        fgListRemove( &text->FontTextures, &texture->Node );
+        free( texture );
+    }
+
+    /* A program is only made once the entry points are all there */
+    if( deleteObjects && text->CoreText.Program )
+    {
+        fghCoreGL.DeleteProgram( text->CoreText.Program );
+        fghCoreGL.DeleteVertexArrays( 1, &text->CoreText.VertexArray );
+        fghCoreGL.DeleteBuffers( 1, &text->CoreText.Buffer );
+        fghCoreGL.DeleteBuffers( 1, &text->CoreText.IndexBuffer );
+    }
+
+    if( fghLastTextContext == text )
+        fghLastTextContext = NULL;
+    fgListRemove( &fghTextContexts, &text->Node );
+    free( text );
+}
+
+static void fghcbUsesContext( SFG_Window* window, SFG_Enumerator* enumerator )
+{
+    if( enumerator->found )
+        return;
+
+    if( ( window != enumerator->data ) &&
+        ( window->Window.Context ==
+          ( ( SFG_Window * )enumerator->data )->Window.Context ) )
+    {
+        enumerator->found = GL_TRUE;
+        return;
+    }
+
+    fgEnumSubWindows( window, fghcbUsesContext, enumerator );
+}
+
+/*
+ * Deletes the atlas textures and core profile text objects of a window's
+ * context, which is about to be destroyed, unless other windows still
+ * share that context. The window has already been taken out of the
+ * window tree.
+ */
+void fgDestroyTextContext( SFG_Window* window )
+{
+    SFG_TextContext* text = fghFindTextContext( window->Window.Context );
+    SFG_Window* current = fgStructure.CurrentWindow;
+    SFG_Enumerator enumerator;
+
+    if( !text )
+        return;
+
+    enumerator.found = GL_FALSE;
+    enumerator.data = window;
+    fgEnumWindows( fghcbUsesContext, &enumerator );
+    if( enumerator.found )
+        return;
+
+    fgSetWindow( window );
+    fghFreeTextContext( text, GL_TRUE );
+    fgSetWindow( current );
+}
+
 /*
- * TODO BEFORE THE STABLE RELEASE:
- *
- *  Test things out ...
+ * Forgets the core profile text entry points and state, and the text
+ * state of any context left, whose objects went with the context
  */
+void fgDestroyCoreText( void )
+{
+    while( fghTextContexts.First )
+        fghFreeTextContext( ( SFG_TextContext * )fghTextContexts.First,
+                            GL_FALSE );
 
-/* -- IMPORT DECLARATIONS -------------------------------------------------- */
+    memset( &fghCoreGL, 0, sizeof( fghCoreGL ) );
+    fghTextPosition[ 0 ] = fghTextPosition[ 1 ] = 0.0f;
+    fghTextColor[ 0 ] = fghTextColor[ 1 ] = 1.0f;
+    fghTextColor[ 2 ] = fghTextColor[ 3 ] = 1.0f;
+    memset( fghTextOrtho, 0, sizeof( fghTextOrtho ) );
+}
 
 /*
- * These are the font faces defined in freeglut_font_data.c file:
+ * The retained text objects, indexed by ID - 1. Slots of destroyed
+ * texts are NULL until a new text takes them.
  */
-extern SFG_Font fgFontFixed8x13;
-extern SFG_Font fgFontFixed9x15;
-extern SFG_Font fgFontHelvetica10;
-extern SFG_Font fgFontHelvetica12;
-extern SFG_Font fgFontHelvetica18;
-extern SFG_Font fgFontTimesRoman10;
-extern SFG_Font fgFontTimesRoman24;
-extern SFG_StrokeFont fgStrokeRoman;
-extern SFG_StrokeFont fgStrokeMonoRoman;
-
+static SFG_Text** fghTexts = NULL;
+static int        fghNumTextSlots = 0;
 
-/* -- PRIVATE FUNCTIONS ---------------------------------------------------- */
+static SFG_Text* fghTextByID( int text )
+{
+    if( ( text < 1 ) || ( text > fghNumTextSlots ) || !fghTexts[ text - 1 ] )
+    {
+        fgWarning( "text %d not found", text );
+        return NULL;
+    }
+    return fghTexts[ text - 1 ];
+}
 
 /*
- * Matches a font ID with a SFG_Font structure pointer.
- * This was changed to match the GLUT header style.
+ * Lays a text object's string out and keeps its own copy of the batch
  */
-static SFG_Font* fghFontByID( void* font )
+static void fghLayoutText( SFG_Text* text, const unsigned char* string )
 {
-    if( font == GLUT_BITMAP_8_BY_13        )
-        return &fgFontFixed8x13;
-    if( font == GLUT_BITMAP_9_BY_15        )
-        return &fgFontFixed9x15;
-    if( font == GLUT_BITMAP_HELVETICA_10   )
-        return &fgFontHelvetica10;
-    if( font == GLUT_BITMAP_HELVETICA_12   )
-        return &fgFontHelvetica12;
-    if( font == GLUT_BITMAP_HELVETICA_18   )
-        return &fgFontHelvetica18;
-    if( font == GLUT_BITMAP_TIMES_ROMAN_10 )
-        return &fgFontTimesRoman10;
-    if( font == GLUT_BITMAP_TIMES_ROMAN_24 )
-        return &fgFontTimesRoman24;
+    size_t length;
+
+    if( !string )
+        string = ( const unsigned char * )"";
+    length = strlen( ( const char * )string );
+
+    free( text->String );
+    free( text->Vertices );
+    free( text->First );
+    free( text->Count );
+    text->Vertices = NULL;
+    text->First = NULL;
+    text->Count = NULL;
+    text->NumQuads = text->NumStrips = 0;
+
+    text->String = ( unsigned char * )malloc( length + 1 );
+    if( !text->String )
+        fgError( "Failed to allocate memory in fghLayoutText" );
+    memcpy( text->String, string, length + 1 );
+
+    if( text->Font )
+    {
+        int outside = 0;
+
+        text->Atlas = fghFontAtlas( text->Font, 0, text->Font->Quantity );
+        if( text->Atlas )
+            text->NumQuads = fghLayoutBitmapText( text->Font, text->Atlas,
+                                                  string, text->Advance,
+                                                  text->Bounds, &outside );
+        if( !text->Atlas || ( text->NumQuads == -1 ) )
+            fgError( "Failed to allocate memory in fghLayoutText" );
 
-    fgWarning( "font 0x%08x not found", font );
-    return 0;
+        /* Characters past the atlas are drawn by glutBitmapString() */
+        if( outside )
+        {
+            text->Atlas = NULL;
+            text->NumQuads = 0;
+        }
+
+        if( text->NumQuads > 0 )
+        {
+            size_t size = text->NumQuads * 4 * 5 * sizeof( GLfloat );
+
+            text->Vertices = ( GLfloat * )malloc( size );
+            if( !text->Vertices )
+                fgError( "Failed to allocate memory in fghLayoutText" );
+            memcpy( text->Vertices, fghTextBatch, size );
+        }
+    }
+    else
+    {
+        text->NumStrips = fghLayoutStrokeText( text->StrokeFont, string,
+                                               text->Advance, text->Bounds );
+        if( text->NumStrips > 0 )
+        {
+            int last = text->NumStrips - 1;
+            size_t size = 2 * ( fghStrokeBatch.First[ last ] +
+                                fghStrokeBatch.Count[ last ] ) *
+                          sizeof( GLfloat );
+
+            text->Vertices = ( GLfloat * )malloc( size );
+            text->First = ( GLint * )malloc( text->NumStrips *
+                                             sizeof( GLint ) );
+            text->Count = ( GLsizei * )malloc( text->NumStrips *
+                                               sizeof( GLsizei ) );
+            if( !text->Vertices || !text->First || !text->Count )
+                fgError( "Failed to allocate memory in fghLayoutText" );
+            memcpy( text->Vertices, fghStrokeBatch.Vertices, size );
+            memcpy( text->First, fghStrokeBatch.First,
+                    text->NumStrips * sizeof( GLint ) );
+            memcpy( text->Count, fghStrokeBatch.Count,
+                    text->NumStrips * sizeof( GLsizei ) );
+        }
+    }
+}
+
+static void fghFreeText( SFG_Text* text )
+{
+    fghTexts[ text->ID - 1 ] = NULL;
+    free( text->String );
+    free( text->Vertices );
+    free( text->First );
+    free( text->Count );
+    free( text );
 }
 
 /*
- * Matches a font ID with a SFG_StrokeFont structure pointer.
- * This was changed to match the GLUT header style.
+ * Frees all the retained text objects
  */
-static SFG_StrokeFont* fghStrokeByID( void* font )
+void fgDestroyTexts( void )
 {
-    if( font == GLUT_STROKE_ROMAN      )
-        return &fgStrokeRoman;
-    if( font == GLUT_STROKE_MONO_ROMAN )
-        return &fgStrokeMonoRoman;
+    int i;
 
-    fgWarning( "stroke font 0x%08x not found", font );
-    return 0;
+    for( i = 0; i < fghNumTextSlots; i++ )
+        if( fghTexts[ i ] )
+            fghFreeText( fghTexts[ i ] );
+
+    free( fghTexts );
+    fghTexts = NULL;
+    fghNumTextSlots = 0;
 }
 
 
@@ -100,79 +2523,171 @@ static SFG_StrokeFont* fghStrokeByID( void* font )
  */
 void FGAPIENTRY glutBitmapCharacter( void* fontID, int character )
 {
-    const GLubyte* face;
+    const GLubyte *face, *bits;
+    GLfloat origin[ 2 ];
+    int width, height;
     SFG_Font* font;
+    SFG_Window* window;
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutBitmapCharacter" );
-    font = fghFontByID( fontID );
-    freeglut_return_if_fail( ( character >= 1 )&&( character < 256 ) );
+    if( fghBitmapScopeID && ( fontID == fghBitmapScopeID ) )
+        font = fghBitmapScopeFont;
+    else
+        font = fghFontByID( fontID );
+    freeglut_return_if_fail( ( character >= 1 ) &&
+                             ( character <= FGH_MAX_CHARACTER ) );
     freeglut_return_if_fail( font );
 
     /*
      * Find the character we want to draw (???)
      */
-    face = font->Characters[ character ];
+    face = fghGlyph( font, character );
 
-    glPushClientAttrib( GL_CLIENT_PIXEL_STORE_BIT );
-    glPixelStorei( GL_UNPACK_SWAP_BYTES,  GL_FALSE );
-    glPixelStorei( GL_UNPACK_LSB_FIRST,   GL_FALSE );
-    glPixelStorei( GL_UNPACK_ROW_LENGTH,  0        );
-    glPixelStorei( GL_UNPACK_SKIP_ROWS,   0        );
-    glPixelStorei( GL_UNPACK_SKIP_PIXELS, 0        );
-    glPixelStorei( GL_UNPACK_ALIGNMENT,   1        );
+    if( ( window = fghCoreTextWindow( ) ) )
+    {
+        SFG_FontAtlas* atlas = fghGlyphAtlas( font, character );
+        GLfloat quad[ 4 * 5 ], advance[ 2 ];
+        int quads = 0;
+
+        /* With no atlas for the character there is only its advance */
+        if( atlas )
+        {
+            const int i = character - atlas->First;
+            const GLfloat* box = atlas->Boxes + 4 * i;
+
+            if( ( box[ 2 ] > box[ 0 ] ) && ( box[ 3 ] > box[ 1 ] ) )
+            {
+                fghPutQuad( quad, atlas->TexCoords + 4 * i,
+                            box[ 0 ], box[ 1 ], box[ 2 ], box[ 3 ] );
+                quads = 1;
+            }
+        }
+        advance[ 0 ] = face[ 0 ];
+        advance[ 1 ] = 0.0f;
+        fghCoreBitmapText( window, atlas, quad, quads, advance );
+        return;
+    }
+
+    /* Inside glutBitmapBegin() the pixel store is already set up */
+    if( !fghBitmapScopeID )
+    {
+        glPushClientAttrib( GL_CLIENT_PIXEL_STORE_BIT );
+        fghSetPixelStore( );
+    }
+    bits = fghGlyphBitmap( font, face, &width, &height, origin );
     glBitmap(
-        face[ 0 ], font->Height,      /* The bitmap's width and height  */
-        font->xorig, font->yorig,     /* The origin in the font glyph   */
+        width, height,                /* The bitmap's width and height  */
+        origin[ 0 ], origin[ 1 ],     /* The origin in the font glyph   */
         ( float )( face[ 0 ] ), 0.0,  /* The raster advance -- inc. x,y */
-        ( face + 1 )                  /* The packed bitmap data...      */
+        bits                          /* The packed bitmap data...      */
     );
-    glPopClientAttrib( );
+    if( !fghBitmapScopeID )
+        glPopClientAttrib( );
 }
 
 void FGAPIENTRY glutBitmapString( void* fontID, const unsigned char *string )
 {
-    unsigned char c;
+    unsigned int c;
     float x = 0.0f ;
     SFG_Font* font;
+    SFG_Window* window;
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutBitmapString" );
     font = fghFontByID( fontID );
     freeglut_return_if_fail( font );
     if ( !string || ! *string )
         return;
 
-    glPushClientAttrib( GL_CLIENT_PIXEL_STORE_BIT );
-    glPixelStorei( GL_UNPACK_SWAP_BYTES,  GL_FALSE );
-    glPixelStorei( GL_UNPACK_LSB_FIRST,   GL_FALSE );
-    glPixelStorei( GL_UNPACK_ROW_LENGTH,  0        );
-    glPixelStorei( GL_UNPACK_SKIP_ROWS,   0        );
-    glPixelStorei( GL_UNPACK_SKIP_PIXELS, 0        );
-    glPixelStorei( GL_UNPACK_ALIGNMENT,   1        );
+    if( ( window = fghCoreTextWindow( ) ) )
+    {
+        fghCoreBitmapString( window, font, string );
+        return;
+    }
+
+    if( fgState.BitmapFontAtlas && fghBitmapStringAtlas( font, string ) )
+        return;
+
+    if( !fghBitmapScopeID )
+    {
+        glPushClientAttrib( GL_CLIENT_PIXEL_STORE_BIT );
+        fghSetPixelStore( );
+    }
 
     /*
      * Step through the string, drawing each character.
      * A newline will simply translate the next character's insertion
      * point back to the start of the line and down one line.
      */
-    while( ( c = *string++) )
-        if( c == '\n' )
+    while( *string )
+        if( ( c = FGH_NEXT_CHARACTER( string ) ) == '\n' )
         {
             glBitmap ( 0, 0, 0, 0, -x, (float) -font->Height, NULL );
             x = 0.0f;
         }
         else  /* Not an EOL, draw the bitmap character */
         {
-            const GLubyte* face = font->Characters[ c ];
+            const GLubyte* face = fghGlyph( font, c );
+            GLfloat origin[ 2 ];
+            int width, height;
+            const GLubyte* bits = fghGlyphBitmap( font, face, &width, &height,
+                                                  origin );
 
             glBitmap(
-                face[ 0 ], font->Height,     /* Bitmap's width and height    */
-                font->xorig, font->yorig,    /* The origin in the font glyph */
+                width, height,               /* Bitmap's width and height    */
+                origin[ 0 ], origin[ 1 ],    /* The origin in the font glyph */
                 ( float )( face[ 0 ] ), 0.0, /* The raster advance; inc. x,y */
-                ( face + 1 )                 /* The packed bitmap data...    */
+                bits                         /* The packed bitmap data...    */
             );
 
             x += ( float )( face[ 0 ] );
         }
 
-    glPopClientAttrib( );
+    if( !fghBitmapScopeID )
+        glPopClientAttrib( );
+}
+
+/*
+ * Opens a scope for drawing many bitmap characters, see glutBitmapEnd().
+ * The pixel store is set up once here instead of for every character.
+ */
+void FGAPIENTRY glutBitmapBegin( void* fontID )
+{
+    SFG_Font* font;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutBitmapBegin" );
+    if( fghBitmapScopeID )
+    {
+        fgWarning( "glutBitmapBegin(): already inside glutBitmapBegin()" );
+        return;
+    }
+    font = fghFontByID( fontID );
+    freeglut_return_if_fail( font );
+
+    /* Core profile text doesn't use the pixel store */
+    fghBitmapScopePushed = !fghCoreTextWindow( );
+    if( fghBitmapScopePushed )
+    {
+        glPushClientAttrib( GL_CLIENT_PIXEL_STORE_BIT );
+        fghSetPixelStore( );
+    }
+    fghBitmapScopeID = fontID;
+    fghBitmapScopeFont = font;
+}
+
+/*
+ * Closes the glutBitmapBegin() scope, restoring the pixel store
+ */
+void FGAPIENTRY glutBitmapEnd( void )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutBitmapEnd" );
+    if( !fghBitmapScopeID )
+    {
+        fgWarning( "glutBitmapEnd(): no matching glutBitmapBegin()" );
+        return;
+    }
+
+    if( fghBitmapScopePushed )
+        glPopClientAttrib( );
+    fghBitmapScopeID = NULL;
+    fghBitmapScopeFont = NULL;
+    fghBitmapScopePushed = GL_FALSE;
 }
 
 /*
@@ -183,9 +2698,12 @@ int FGAPIENTRY glutBitmapWidth( void* fontID, int character )
     SFG_Font* font;
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutBitmapWidth" );
     font = fghFontByID( fontID );
-    freeglut_return_val_if_fail( character > 0 && character < 256, 0 );
+    freeglut_return_val_if_fail( ( character > 0 ) &&
+                                 ( character <= FGH_MAX_CHARACTER ), 0 );
     freeglut_return_val_if_fail( font, 0 );
-    return *( font->Characters[ character ] );
+    if( character < font->Quantity )
+        return fghAdvances( font )[ character ];
+    return *fghGlyph( font, character );
 }
 
 /*
@@ -193,8 +2711,6 @@ int FGAPIENTRY glutBitmapWidth( void* fontID, int character )
  */
 int FGAPIENTRY glutBitmapLength( void* fontID, const unsigned char* string )
 {
-    unsigned char c;
-    int length = 0, this_line_length = 0;
     SFG_Font* font;
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutBitmapLength" );
     font = fghFontByID( fontID );
@@ -202,21 +2718,25 @@ int FGAPIENTRY glutBitmapLength( void* fontID, const unsigned char* string )
     if ( !string || ! *string )
         return 0;
 
-    while( ( c = *string++) )
-    {
-        if( c != '\n' )/* Not an EOL, increment length of line */
-            this_line_length += *( font->Characters[ c ]);
-        else  /* EOL; reset the length of this line */
-        {
-            if( length < this_line_length )
-                length = this_line_length;
-            this_line_length = 0;
-        }
-    }
-    if ( length < this_line_length )
-        length = this_line_length;
+    return fghBitmapLength( font, string,
+                            string + strlen( ( const char * )string ) );
+}
 
-    return length;
+/*
+ * Return the width of the first length bytes of a string drawn using a
+ * bitmap font. They are all measured, NUL bytes included.
+ */
+int FGAPIENTRY glutBitmapLengthN( void* fontID, const unsigned char* string,
+                                  int length )
+{
+    SFG_Font* font;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutBitmapLengthN" );
+    font = fghFontByID( fontID );
+    freeglut_return_val_if_fail( font, 0 );
+    if ( !string || ( length <= 0 ) )
+        return 0;
+
+    return fghBitmapLength( font, string, string + length );
 }
 
 /*
@@ -236,81 +2756,74 @@ int FGAPIENTRY glutBitmapHeight( void* fontID )
  */
 void FGAPIENTRY glutStrokeCharacter( void* fontID, int character )
 {
-    const SFG_StrokeChar *schar;
-    const SFG_StrokeStrip *strip;
-    int i, j;
+    int first, last;
     SFG_StrokeFont* font;
+    SFG_Window* window;
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutStrokeCharacter" );
     font = fghStrokeByID( fontID );
+    freeglut_return_if_fail( font );
     freeglut_return_if_fail( character >= 0 );
     freeglut_return_if_fail( character < font->Quantity );
-    freeglut_return_if_fail( font );
 
-    schar = font->Characters[ character ];
-    freeglut_return_if_fail( schar );
-    strip = schar->Strips;
+    if( ( window = fghCoreTextWindow( ) ) )
+    {
+        /* The stroke fonts' characters are all ASCII */
+        unsigned char string[ 2 ];
+        GLfloat advance[ 2 ];
+        int numStrips = 0;
+
+        string[ 0 ] = ( unsigned char )character;
+        string[ 1 ] = '\0';
+        if( character && ( character != '\n' ) )
+            numStrips = fghLayoutStrokeText( font, string, advance, NULL );
+        advance[ 0 ] = font->Right[ character ];
+        advance[ 1 ] = 0.0f;
+        fghCoreStrokeText( window, fghStrokeBatch.Vertices,
+                           fghStrokeBatch.First, fghStrokeBatch.Count,
+                           numStrips, advance );
+        return;
+    }
 
-    for( i = 0; i < schar->Number; i++, strip++ )
+    first = font->FirstStrip[ character ];
+    last = font->FirstStrip[ character + 1 ];
+
+    if( last > first )
     {
-        glBegin( GL_LINE_STRIP );
-        for( j = 0; j < strip->Number; j++ )
-            glVertex2f( strip->Vertices[ j ].X, strip->Vertices[ j ].Y );
-        glEnd( );
-				glBegin( GL_POINTS );
-        for( j = 0; j < strip->Number; j++ )
-            glVertex2f( strip->Vertices[ j ].X, strip->Vertices[ j ].Y );
-				glEnd( );
+        glPushClientAttrib( GL_CLIENT_VERTEX_ARRAY_BIT );
+        glInterleavedArrays( GL_V2F, 0, font->Vertices );
+        fghMultiDrawArrays( GL_LINE_STRIP, font->First + first,
+                            font->Count + first, last - first );
+
+        /* The strips' vertices are contiguous, so one call draws them all */
+        if( fgState.StrokeFontPoints )
+            glDrawArrays( GL_POINTS, font->First[ first ],
+                          font->First[ last - 1 ] + font->Count[ last - 1 ] -
+                          font->First[ first ] );
+        glPopClientAttrib( );
     }
-    glTranslatef( schar->Right, 0.0, 0.0 );
+    glTranslatef( font->Right[ character ], 0.0, 0.0 );
 }
 
 void FGAPIENTRY glutStrokeString( void* fontID, const unsigned char *string )
 {
-    unsigned char c;
-    int i, j;
-    float length = 0.0;
+    GLfloat advance[ 2 ];
+    int numStrips;
     SFG_StrokeFont* font;
+    SFG_Window* window;
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutStrokeString" );
     font = fghStrokeByID( fontID );
     freeglut_return_if_fail( font );
     if ( !string || ! *string )
         return;
 
-    /*
-     * Step through the string, drawing each character.
-     * A newline will simply translate the next character's insertion
-     * point back to the start of the line and down one line.
-     */
-    while( ( c = *string++) )
-        if( c < font->Quantity )
-        {
-            if( c == '\n' )
-            {
-                glTranslatef ( -length, -( float )( font->Height ), 0.0 );
-                length = 0.0;
-            }
-            else  /* Not an EOL, draw the bitmap character */
-            {
-                const SFG_StrokeChar *schar = font->Characters[ c ];
-                if( schar )
-                {
-                    const SFG_StrokeStrip *strip = schar->Strips;
-
-                    for( i = 0; i < schar->Number; i++, strip++ )
-                    {
-                        glBegin( GL_LINE_STRIP );
-                        for( j = 0; j < strip->Number; j++ )
-                            glVertex2f( strip->Vertices[ j ].X,
-                                        strip->Vertices[ j ].Y);
-
-                        glEnd( );
-                    }
-
-                    length += schar->Right;
-                    glTranslatef( schar->Right, 0.0, 0.0 );
-                }
-            }
-        }
+    numStrips = fghLayoutStrokeText( font, string, advance, NULL );
+    if( ( window = fghCoreTextWindow( ) ) )
+        fghCoreStrokeText( window, fghStrokeBatch.Vertices,
+                           fghStrokeBatch.First, fghStrokeBatch.Count,
+                           numStrips, advance );
+    else
+        fghDrawStrokeText( fghStrokeBatch.Vertices, fghStrokeBatch.First,
+                           fghStrokeBatch.Count, numStrips, advance );
 }
 
 /*
@@ -318,7 +2831,6 @@ void FGAPIENTRY glutStrokeString( void* fontID, const unsigned char *string )
  */
 int FGAPIENTRY glutStrokeWidth( void* fontID, int character )
 {
-    const SFG_StrokeChar *schar;
     SFG_StrokeFont* font;
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutStrokeWidth" );
     font = fghStrokeByID( fontID );
@@ -327,10 +2839,8 @@ int FGAPIENTRY glutStrokeWidth( void* fontID, int character )
                                  0
     );
     freeglut_return_val_if_fail( font, 0 );
-    schar = font->Characters[ character ];
-    freeglut_return_val_if_fail( schar, 0 );
 
-    return ( int )( schar->Right + 0.5 );
+    return ( int )( font->Right[ character ] + 0.5 );
 }
 
 /*
@@ -338,9 +2848,6 @@ int FGAPIENTRY glutStrokeWidth( void* fontID, int character )
  */
 int FGAPIENTRY glutStrokeLength( void* fontID, const unsigned char* string )
 {
-    unsigned char c;
-    float length = 0.0;
-    float this_line_length = 0.0;
     SFG_StrokeFont* font;
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutStrokeLength" );
     font = fghStrokeByID( fontID );
@@ -348,25 +2855,24 @@ int FGAPIENTRY glutStrokeLength( void* fontID, const unsigned char* string )
     if ( !string || ! *string )
         return 0;
 
-    while( ( c = *string++) )
-        if( c < font->Quantity )
-        {
-            if( c == '\n' ) /* EOL; reset the length of this line */
-            {
-                if( length < this_line_length )
-                    length = this_line_length;
-                this_line_length = 0.0;
-            }
-            else  /* Not an EOL, increment the length of this line */
-            {
-                const SFG_StrokeChar *schar = font->Characters[ c ];
-                if( schar )
-                    this_line_length += schar->Right;
-            }
-        }
-    if( length < this_line_length )
-        length = this_line_length;
-    return( int )( length + 0.5 );
+    return( int )( fghStrokeLength( font, string, NULL ) + 0.5 );
+}
+
+/*
+ * Return the width of the first length bytes of a string drawn using a
+ * stroke font. They are all measured, NUL bytes included.
+ */
+int FGAPIENTRY glutStrokeLengthN( void* fontID, const unsigned char* string,
+                                  int length )
+{
+    SFG_StrokeFont* font;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutStrokeLengthN" );
+    font = fghStrokeByID( fontID );
+    freeglut_return_val_if_fail( font, 0 );
+    if ( !string || ( length <= 0 ) )
+        return 0;
+
+    return( int )( fghStrokeLength( font, string, string + length ) + 0.5 );
 }
 
 /*
@@ -381,4 +2887,242 @@ GLfloat FGAPIENTRY glutStrokeHeight( void* fontID )
     return font->Height;
 }
 
+/*
+ * Sets where the next string starts in core profile contexts, which have
+ * no raster position or modelview matrix, in glutTextOrtho() coordinates.
+ * Drawing text moves it on past the text.
+ */
+void FGAPIENTRY glutTextPosition( GLfloat x, GLfloat y )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutTextPosition" );
+    fghTextPosition[ 0 ] = x;
+    fghTextPosition[ 1 ] = y;
+}
+
+/*
+ * Sets the colour of text in core profile contexts
+ */
+void FGAPIENTRY glutTextColor( GLfloat red, GLfloat green, GLfloat blue,
+                               GLfloat alpha )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutTextColor" );
+    fghTextColor[ 0 ] = red;
+    fghTextColor[ 1 ] = green;
+    fghTextColor[ 2 ] = blue;
+    fghTextColor[ 3 ] = alpha;
+}
+
+/*
+ * Sets the orthographic transform of text in core profile contexts, as
+ * the coordinates of the viewport's left, right, bottom and top edges.
+ * With left equal to right or bottom to top, text coordinates go back
+ * to being pixels from the viewport's lower left corner.
+ */
+void FGAPIENTRY glutTextOrtho( GLfloat left, GLfloat right,
+                               GLfloat bottom, GLfloat top )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutTextOrtho" );
+    if( ( left == right ) || ( bottom == top ) )
+    {
+        memset( fghTextOrtho, 0, sizeof( fghTextOrtho ) );
+        return;
+    }
+
+    fghTextOrtho[ 0 ] = 2.0f / ( right - left );
+    fghTextOrtho[ 1 ] = 2.0f / ( top - bottom );
+    fghTextOrtho[ 2 ] = -( right + left ) / ( right - left );
+    fghTextOrtho[ 3 ] = -( top + bottom ) / ( top - bottom );
+}
+
+/*
+ * Creates a text object, laying the string out once so that it can be
+ * drawn repeatedly without walking and measuring its characters again.
+ * Bitmap text is drawn from the font's atlas texture.
+ */
+int FGAPIENTRY glutCreateText( void* fontID, const unsigned char* string )
+{
+    SFG_Text* text;
+    int i;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutCreateText" );
+
+    text = ( SFG_Text * )calloc( sizeof( SFG_Text ), 1 );
+    if( !text )
+        fgError( "Failed to allocate memory in glutCreateText" );
+    text->FontID = fontID;
+    text->Font = fghFindFont( fontID );
+    if( !text->Font )
+        text->StrokeFont = fghFindStroke( fontID );
+    if( !text->Font && !text->StrokeFont )
+    {
+        fgWarning( "glutCreateText(): font 0x%08x not found", fontID );
+        free( text );
+        return 0;
+    }
+
+    for( i = 0; ( i < fghNumTextSlots ) && fghTexts[ i ]; i++ )
+        ;
+    if( i == fghNumTextSlots )
+    {
+        int slots = fghNumTextSlots ? 2 * fghNumTextSlots : 16;
+        SFG_Text** texts = ( SFG_Text ** )realloc( fghTexts,
+                                                   slots * sizeof( SFG_Text * ) );
+
+        if( !texts )
+            fgError( "Failed to allocate memory in glutCreateText" );
+        memset( texts + fghNumTextSlots, 0,
+                ( slots - fghNumTextSlots ) * sizeof( SFG_Text * ) );
+        fghTexts = texts;
+        fghNumTextSlots = slots;
+    }
+    text->ID = i + 1;
+    fghTexts[ i ] = text;
+
+    fghLayoutText( text, string );
+    return text->ID;
+}
+
+/*
+ * Replaces the string of a text object and lays it out again
+ */
+void FGAPIENTRY glutUpdateText( int textID, const unsigned char* string )
+{
+    SFG_Text* text;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutUpdateText" );
+    text = fghTextByID( textID );
+    freeglut_return_if_fail( text );
+
+    if( string && !strcmp( ( const char * )text->String,
+                           ( const char * )string ) )
+        return;
+    fghLayoutText( text, string );
+}
+
+/*
+ * Draws a text object with a single draw call. Like glutBitmapString()
+ * and glutStrokeString() it starts at the current raster position or
+ * modelview origin, and moves them on past the text.
+ */
+void FGAPIENTRY glutDrawText( int textID )
+{
+    SFG_Text* text;
+    SFG_Window* window;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutDrawText" );
+    text = fghTextByID( textID );
+    freeglut_return_if_fail( text );
+
+    if( ( window = fghCoreTextWindow( ) ) )
+    {
+        if( text->StrokeFont )
+            fghCoreStrokeText( window, text->Vertices, text->First,
+                               text->Count, text->NumStrips, text->Advance );
+        else if( text->Atlas )
+            fghCoreBitmapText( window, text->Atlas, text->Vertices,
+                               text->NumQuads, text->Advance );
+        else
+            glutBitmapString( text->FontID, text->String );
+    }
+    else if( text->StrokeFont )
+        fghDrawStrokeText( text->Vertices, text->First, text->Count,
+                           text->NumStrips, text->Advance );
+    else if( !fgStructure.CurrentWindow || !text->Atlas ||
+             !fghDrawBitmapText( text->Atlas, text->Vertices, text->NumQuads,
+                                 text->Advance ) )
+        glutBitmapString( text->FontID, text->String );
+}
+
+/*
+ * Returns the box around a text object's glyphs, relative to where it
+ * starts: the left, bottom, right and top edges, in pixels for bitmap
+ * fonts and in font units for stroke fonts
+ */
+void FGAPIENTRY glutGetTextBounds( int textID, GLfloat* bounds )
+{
+    SFG_Text* text;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutGetTextBounds" );
+    text = fghTextByID( textID );
+    freeglut_return_if_fail( text );
+    freeglut_return_if_fail( bounds );
+
+    memcpy( bounds, text->Bounds, 4 * sizeof( GLfloat ) );
+}
+
+/*
+ * Destroys a text object
+ */
+void FGAPIENTRY glutDestroyText( int textID )
+{
+    SFG_Text* text;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutDestroyText" );
+    text = fghTextByID( textID );
+    freeglut_return_if_fail( text );
+
+    fghFreeText( text );
+}
+
+/*
+ * Loads a BDF or PCF bitmap font and returns its font ID, to be used
+ * like GLUT_BITMAP_9_BY_15 and friends. The file is mapped into memory
+ * and each character is converted the first time it is drawn.
+ */
+void* FGAPIENTRY glutLoadBitmapFont( const char* path )
+{
+    SFG_FontEntry* entry;
+    SFG_Font* font;
+    SFG_FontFile* file;
+    GLboolean indexed;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutLoadBitmapFont" );
+    freeglut_return_val_if_fail( path, NULL );
+
+    if( fghNumLoadedFonts == FGH_MAX_LOADED_FONTS )
+    {
+        fgWarning( "glutLoadBitmapFont(): too many fonts loaded" );
+        return NULL;
+    }
+
+    font = ( SFG_Font * )calloc( sizeof( SFG_Font ), 1 );
+    file = ( SFG_FontFile * )calloc( sizeof( SFG_FontFile ), 1 );
+    if( !font || !file )
+        fgError( "Out of memory. Could not load font \"%s\".", path );
+    font->File = file;
+    font->Quantity = 256;
+    font->Name = strdup( path );
+    font->Characters = ( const GLubyte ** )calloc( font->Quantity,
+                                                   sizeof( GLubyte * ) );
+    if( !font->Name || !font->Characters )
+        fgError( "Out of memory. Could not load font \"%s\".", path );
+    file->DefaultGlyph = -1;
+
+    if( !fghMapFontFile( file, path ) )
+    {
+        fgWarning( "glutLoadBitmapFont(): could not open \"%s\"", path );
+        fghFreeLoadedFont( font );
+        return NULL;
+    }
+
+    if( ( file->Size >= 4 ) && !memcmp( file->Data, "\1fcp", 4 ) )
+    {
+        file->Format = FG_FONT_FILE_PCF;
+        indexed = fghIndexPCF( font );
+    }
+    else
+    {
+        file->Format = FG_FONT_FILE_BDF;
+        indexed = fghIndexBDF( font );
+    }
+    if( !indexed || ( font->Height <= 0 ) )
+    {
+        fgWarning( "glutLoadBitmapFont(): \"%s\" is not a BDF or PCF font",
+                   path );
+        fghFreeLoadedFont( font );
+        return NULL;
+    }
+
+    entry = fghFontRegistry + FGH_NUM_BUILTIN_FONTS + fghNumLoadedFonts;
+    entry->ID = ( void * )( size_t )( FGH_LOADED_FONT_ID + fghNumLoadedFonts );
+    entry->Font = font;
+    fghNumLoadedFonts++;
+
+    return entry->ID;
+}
+
 /*** END OF FILE ***/
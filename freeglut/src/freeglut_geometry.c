@@ -59,755 +59,1240 @@
  */
 
 
-/* -- INTERFACE FUNCTIONS -------------------------------------------------- */
+/* -- PRIVATE FUNCTIONS ---------------------------------------------------- */
 
 /*
- * Draws a wireframed cube. Code contributed by Andreas Umbach <marvin@dataway.ch>
+ * The cached meshes, most recently used first
  */
-void FGAPIENTRY glutWireCube( GLdouble dSize )
-{
-    double size = dSize * 0.5;
-
-    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireCube" );
-
-#   define V(a,b,c) glVertex3d( a size, b size, c size );
-#   define N(a,b,c) glNormal3d( a, b, c );
+static SFG_List fgMeshes = { NULL, NULL };
+static int      fgNumMeshes = 0;
 
-    /* PWO: I dared to convert the code to use macros... */
-    glBegin( GL_LINE_LOOP ); N( 1.0, 0.0, 0.0); V(+,-,+); V(+,-,-); V(+,+,-); V(+,+,+); glEnd();
-    glBegin( GL_LINE_LOOP ); N( 0.0, 1.0, 0.0); V(+,+,+); V(+,+,-); V(-,+,-); V(-,+,+); glEnd();
-    glBegin( GL_LINE_LOOP ); N( 0.0, 0.0, 1.0); V(+,+,+); V(-,+,+); V(-,-,+); V(+,-,+); glEnd();
-    glBegin( GL_LINE_LOOP ); N(-1.0, 0.0, 0.0); V(-,-,+); V(-,+,+); V(-,+,-); V(-,-,-); glEnd();
-    glBegin( GL_LINE_LOOP ); N( 0.0,-1.0, 0.0); V(-,-,+); V(-,-,-); V(+,-,-); V(+,-,+); glEnd();
-    glBegin( GL_LINE_LOOP ); N( 0.0, 0.0,-1.0); V(-,-,-); V(-,+,-); V(+,+,-); V(+,-,-); glEnd();
-
-#   undef V
-#   undef N
+static void fghDestroyMesh( SFG_Mesh* mesh )
+{
+    fgListRemove( &fgMeshes, &mesh->Node );
+    fgNumMeshes--;
+
+    free( mesh->Vertices );
+    free( mesh->Normals );
+    free( mesh->TexCoords );
+    free( mesh->Indices );
+    free( mesh->LineIndices );
+    free( mesh );
 }
 
 /*
- * Draws a solid cube. Code contributed by Andreas Umbach <marvin@dataway.ch>
+ * Looks up a mesh built for the given shape type and parameters.
+ * A hit is moved to the front of the list so it survives eviction.
  */
-void FGAPIENTRY glutSolidCube( GLdouble dSize )
+SFG_Mesh* fgFindMesh( int type, const GLdouble* keys, int numKeys )
 {
-    double size = dSize * 0.5;
-
-    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidCube" );
-
-#   define V(a,b,c) glVertex3d( a size, b size, c size );
-#   define N(a,b,c) glNormal3d( a, b, c );
+    SFG_Mesh* mesh;
 
-    /* PWO: Again, I dared to convert the code to use macros... */
-    glBegin( GL_QUADS );
-        N( 1.0, 0.0, 0.0); V(+,-,+); V(+,-,-); V(+,+,-); V(+,+,+);
-        N( 0.0, 1.0, 0.0); V(+,+,+); V(+,+,-); V(-,+,-); V(-,+,+);
-        N( 0.0, 0.0, 1.0); V(+,+,+); V(-,+,+); V(-,-,+); V(+,-,+);
-        N(-1.0, 0.0, 0.0); V(-,-,+); V(-,+,+); V(-,+,-); V(-,-,-);
-        N( 0.0,-1.0, 0.0); V(-,-,+); V(-,-,-); V(+,-,-); V(+,-,+);
-        N( 0.0, 0.0,-1.0); V(-,-,-); V(-,+,-); V(+,+,-); V(+,-,-);
-    glEnd();
+    for( mesh = ( SFG_Mesh * )fgMeshes.First;
+         mesh;
+         mesh = ( SFG_Mesh * )mesh->Node.Next )
+    {
+        if( ( mesh->Type == type ) && ( mesh->NumKeys == numKeys ) &&
+            ( memcmp( mesh->Keys, keys, numKeys * sizeof( GLdouble ) ) == 0 ) )
+        {
+            if( mesh != fgMeshes.First )
+            {
+                fgListRemove( &fgMeshes, &mesh->Node );
+                fgListInsert( &fgMeshes, fgMeshes.First, &mesh->Node );
+            }
+            return mesh;
+        }
+    }
 
-#   undef V
-#   undef N
+    return NULL;
 }
 
 /*
- * Compute lookup table of cos and sin values forming a cirle
- *
- * Notes:
- *    It is the responsibility of the caller to free these tables
- *    The size of the table is (n+1) to form a connected loop
- *    The last entry is exactly the same as the first
- *    The sign of n can be flipped to get the reverse loop
+ * Allocates a mesh with room for the given number of vertices and adds
+ * it to the cache. The caller fills in the vertex data and indices.
  */
-
-static void fghCircleTable(double **sint,double **cost,const int n)
+SFG_Mesh* fgCreateMesh( int type, const GLdouble* keys, int numKeys,
+                        int numVertices, GLboolean texCoords )
 {
-    int i;
+    SFG_Mesh* mesh;
 
-    /* Table size, the sign of n flips the circle direction */
+    FREEGLUT_INTERNAL_ERROR_EXIT ( numKeys <= FG_MESH_MAX_KEYS,
+                                   "Too many mesh keys", "fgCreateMesh" );
 
-    const int size = abs(n);
+    mesh = ( SFG_Mesh * )calloc( sizeof( SFG_Mesh ), 1 );
+    if( !mesh )
+        fgError( "Failed to allocate memory in fgCreateMesh" );
 
-    /* Determine the angle between samples */
+    mesh->Type = type;
+    mesh->NumKeys = numKeys;
+    memcpy( mesh->Keys, keys, numKeys * sizeof( GLdouble ) );
 
-    const double angle = 2*M_PI/(double)( ( n == 0 ) ? 1 : n );
+    mesh->NumVertices = numVertices;
+    mesh->Vertices = ( GLfloat * )malloc( 3 * numVertices * sizeof( GLfloat ) );
+    mesh->Normals  = ( GLfloat * )malloc( 3 * numVertices * sizeof( GLfloat ) );
+    if( texCoords )
+        mesh->TexCoords = ( GLfloat * )malloc( 2 * numVertices * sizeof( GLfloat ) );
 
-    /* Allocate memory for n samples, plus duplicate of first entry at the end */
-
-    *sint = (double *) calloc(sizeof(double), size+1);
-    *cost = (double *) calloc(sizeof(double), size+1);
+    if( !mesh->Vertices || !mesh->Normals || ( texCoords && !mesh->TexCoords ) )
+        fgError( "Failed to allocate memory in fgCreateMesh" );
 
-    /* Bail out if memory allocation fails, fgError never returns */
+    /* Make room for the new mesh by dropping the least recently used one */
+    if( fgNumMeshes >= FREEGLUT_MAX_MESHES )
+        fghDestroyMesh( ( SFG_Mesh * )fgMeshes.Last );
 
-    if (!(*sint) || !(*cost))
-    {
-        free(*sint);
-        free(*cost);
-        fgError("Failed to allocate memory in fghCircleTable");
-    }
+    fgListInsert( &fgMeshes, fgMeshes.First, &mesh->Node );
+    fgNumMeshes++;
 
-    /* Compute cos and sin around the circle */
+    return mesh;
+}
 
-    (*sint)[0] = 0.0;
-    (*cost)[0] = 1.0;
+/*
+ * Draws a cached mesh from client-side vertex arrays.
+ * The wireframe version uses the line indices.
+ */
+void fgDrawMesh( const SFG_Mesh* mesh, GLboolean wire )
+{
+    glPushClientAttrib( GL_CLIENT_VERTEX_ARRAY_BIT );
 
-    for (i=1; i<size; i++)
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glVertexPointer( 3, GL_FLOAT, 0, mesh->Vertices );
+    glEnableClientState( GL_NORMAL_ARRAY );
+    glNormalPointer( GL_FLOAT, 0, mesh->Normals );
+    if( mesh->TexCoords )
     {
-        (*sint)[i] = sin(angle*i);
-        (*cost)[i] = cos(angle*i);
+        glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+        glTexCoordPointer( 2, GL_FLOAT, 0, mesh->TexCoords );
     }
 
-    /* Last sample is duplicate of the first */
+    if( wire )
+        glDrawElements( GL_LINES, mesh->NumLineIndices,
+                        GL_UNSIGNED_INT, mesh->LineIndices );
+    else if( mesh->Indices )
+        glDrawElements( GL_TRIANGLES, mesh->NumIndices,
+                        GL_UNSIGNED_INT, mesh->Indices );
+    else
+        glDrawArrays( GL_TRIANGLES, 0, mesh->NumVertices );
 
-    (*sint)[size] = (*sint)[0];
-    (*cost)[size] = (*cost)[0];
+    glPopClientAttrib( );
 }
 
 /*
- * Draws a solid sphere
+ * Releases every cached mesh, called from fgDeinitialize()
  */
-void FGAPIENTRY glutSolidSphere(GLdouble radius, GLint slices, GLint stacks)
+void fgDestroyMeshes( void )
 {
-    int i,j;
-
-    /* Adjust z and radius as stacks are drawn. */
-
-    double z0,z1;
-    double r0,r1;
-
-    /* Pre-computed circle */
-
-    double *sint1,*cost1;
-    double *sint2,*cost2;
+    while( fgMeshes.First )
+        fghDestroyMesh( ( SFG_Mesh * )fgMeshes.First );
+}
 
-    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidSphere" );
+/*
+ * Vertex cache optimisation of the triangle indices, after Tom Forsyth's
+ * "Linear-Speed Vertex Cache Optimisation". Triangles are emitted greedily,
+ * each time picking the one whose vertices score best against a simulated
+ * LRU cache, and favouring vertices with few triangles left to use them.
+ * This runs once as a mesh is built; if memory is short the mesh simply
+ * keeps its original order.
+ */
+#define  FGH_VERTEX_CACHE_SIZE        32
+#define  FGH_CACHE_DECAY_POWER        1.5
+#define  FGH_LAST_TRIANGLE_SCORE      0.75
+#define  FGH_VALENCE_BOOST_SCALE      2.0
+#define  FGH_VALENCE_BOOST_POWER      0.5
 
-    fghCircleTable(&sint1,&cost1,-slices);
-    fghCircleTable(&sint2,&cost2,stacks*2);
+static float fghVertexScore( int cachePosition, int remaining )
+{
+    float score = 0.0f;
 
-    /* The top stack is covered with a triangle fan */
+    /* Nothing left to draw with this vertex */
+    if( remaining == 0 )
+        return -1.0f;
 
-    z0 = 1.0;
-    z1 = cost2[(stacks>0)?1:0];
-    r0 = 0.0;
-    r1 = sint2[(stacks>0)?1:0];
+    if( cachePosition >= 0 )
+    {
+        /* The last triangle's vertices are scored flat, so that the order within it does not matter */
+        if( cachePosition < 3 )
+            score = ( float )FGH_LAST_TRIANGLE_SCORE;
+        else
+            score = ( float )pow( 1.0 - ( double )( cachePosition - 3 ) /
+                                        ( FGH_VERTEX_CACHE_SIZE - 3 ),
+                                  FGH_CACHE_DECAY_POWER );
+    }
 
-    glBegin(GL_TRIANGLE_FAN);
+    return score + ( float )( FGH_VALENCE_BOOST_SCALE *
+                              pow( remaining, -FGH_VALENCE_BOOST_POWER ) );
+}
 
-        glNormal3d(0,0,1);
-        glVertex3d(0,0,radius);
+void fgOptimizeMesh( SFG_Mesh* mesh )
+{
+    const int numTriangles = mesh->NumIndices / 3;
+    const int numVertices = mesh->NumVertices;
+    int *remaining, *first, *triangles, *cachePosition;
+    float *vertexScore, *triangleScore;
+    char *emitted;
+    GLuint *out;
+    int cache[ FGH_VERTEX_CACHE_SIZE + 3 ], cacheSize = 0;
+    int i, j, k, n, best = -1;
+
+    if( numTriangles < 2 )
+        return;
+
+    remaining     = ( int * )calloc( numVertices, sizeof( int ) );
+    first         = ( int * )malloc( ( numVertices + 1 ) * sizeof( int ) );
+    triangles     = ( int * )malloc( 3 * numTriangles * sizeof( int ) );
+    cachePosition = ( int * )malloc( numVertices * sizeof( int ) );
+    vertexScore   = ( float * )malloc( numVertices * sizeof( float ) );
+    triangleScore = ( float * )malloc( numTriangles * sizeof( float ) );
+    emitted       = ( char * )calloc( numTriangles, 1 );
+    out           = ( GLuint * )malloc( mesh->NumIndices * sizeof( GLuint ) );
+
+    if( remaining && first && triangles && cachePosition &&
+        vertexScore && triangleScore && emitted && out )
+    {
+        /* The triangles using each vertex, packed one vertex after another */
+        for( i = 0; i < mesh->NumIndices; i++ )
+            remaining[ mesh->Indices[ i ] ]++;
 
-        for (j=slices; j>=0; j--)
+        first[ 0 ] = 0;
+        for( i = 0; i < numVertices; i++ )
         {
-            glNormal3d(cost1[j]*r1,        sint1[j]*r1,        z1       );
-            glVertex3d(cost1[j]*r1*radius, sint1[j]*r1*radius, z1*radius);
+            first[ i + 1 ] = first[ i ] + remaining[ i ];
+            remaining[ i ] = 0;
         }
 
-    glEnd();
-
-    /* Cover each stack with a quad strip, except the top and bottom stacks */
+        for( i = 0; i < mesh->NumIndices; i++ )
+        {
+            const GLuint v = mesh->Indices[ i ];
+            triangles[ first[ v ] + remaining[ v ]++ ] = i / 3;
+        }
 
-    for( i=1; i<stacks-1; i++ )
-    {
-        z0 = z1; z1 = cost2[i+1];
-        r0 = r1; r1 = sint2[i+1];
+        for( i = 0; i < numVertices; i++ )
+        {
+            cachePosition[ i ] = -1;
+            vertexScore[ i ] = fghVertexScore( -1, remaining[ i ] );
+        }
 
-        glBegin(GL_QUAD_STRIP);
+        for( i = 0; i < numTriangles; i++ )
+            triangleScore[ i ] = vertexScore[ mesh->Indices[ 3 * i + 0 ] ] +
+                                 vertexScore[ mesh->Indices[ 3 * i + 1 ] ] +
+                                 vertexScore[ mesh->Indices[ 3 * i + 2 ] ];
 
-            for(j=0; j<=slices; j++)
+        for( n = 0; n < numTriangles; n++ )
+        {
+            int newCache[ FGH_VERTEX_CACHE_SIZE + 3 ], newCacheSize = 0;
+            float bestScore = -1.0f;
+
+            /*
+             * Nothing in the cache to carry on from, which only happens at
+             * the start of each disconnected piece: search the lot.
+             */
+            if( best < 0 )
+                for( i = 0; i < numTriangles; i++ )
+                    if( !emitted[ i ] && ( triangleScore[ i ] > bestScore ) )
+                    {
+                        bestScore = triangleScore[ i ];
+                        best = i;
+                    }
+
+            emitted[ best ] = 1;
+
+            for( j = 0; j < 3; j++ )
             {
-                glNormal3d(cost1[j]*r1,        sint1[j]*r1,        z1       );
-                glVertex3d(cost1[j]*r1*radius, sint1[j]*r1*radius, z1*radius);
-                glNormal3d(cost1[j]*r0,        sint1[j]*r0,        z0       );
-                glVertex3d(cost1[j]*r0*radius, sint1[j]*r0*radius, z0*radius);
+                const GLuint v = mesh->Indices[ 3 * best + j ];
+
+                out[ 3 * n + j ] = v;
+
+                /* Take the triangle off the vertex's list */
+                for( k = first[ v ]; k < first[ v ] + remaining[ v ]; k++ )
+                    if( triangles[ k ] == best )
+                    {
+                        triangles[ k ] = triangles[ first[ v ] + remaining[ v ] - 1 ];
+                        remaining[ v ]--;
+                        break;
+                    }
+
+                /* ...and put the vertex at the front of the cache */
+                for( k = 0; k < newCacheSize; k++ )
+                    if( newCache[ k ] == ( int )v )
+                        break;
+                if( k == newCacheSize )
+                    newCache[ newCacheSize++ ] = v;
             }
 
-        glEnd();
-    }
+            for( i = 0; i < cacheSize; i++ )
+            {
+                for( k = 0; k < newCacheSize; k++ )
+                    if( newCache[ k ] == cache[ i ] )
+                        break;
+                if( k == newCacheSize )
+                    newCache[ newCacheSize++ ] = cache[ i ];
+            }
 
-    /* The bottom stack is covered with a triangle fan */
+            /*
+             * Rescore everything that was touched, including the vertices
+             * that just fell out of the cache, and look for the best
+             * triangle among those still using a cached vertex.
+             */
+            for( i = 0; i < newCacheSize; i++ )
+            {
+                const int v = newCache[ i ];
 
-    z0 = z1;
-    r0 = r1;
+                cachePosition[ v ] = ( i < FGH_VERTEX_CACHE_SIZE ) ? i : -1;
+                vertexScore[ v ] = fghVertexScore( cachePosition[ v ], remaining[ v ] );
+            }
 
-    glBegin(GL_TRIANGLE_FAN);
+            best = -1;
+            bestScore = -1.0f;
 
-        glNormal3d(0,0,-1);
-        glVertex3d(0,0,-radius);
+            for( i = 0; i < newCacheSize; i++ )
+            {
+                const int v = newCache[ i ];
+
+                for( k = first[ v ]; k < first[ v ] + remaining[ v ]; k++ )
+                {
+                    const int t = triangles[ k ];
+
+                    triangleScore[ t ] = vertexScore[ mesh->Indices[ 3 * t + 0 ] ] +
+                                         vertexScore[ mesh->Indices[ 3 * t + 1 ] ] +
+                                         vertexScore[ mesh->Indices[ 3 * t + 2 ] ];
+
+                    if( ( cachePosition[ v ] >= 0 ) && ( triangleScore[ t ] > bestScore ) )
+                    {
+                        bestScore = triangleScore[ t ];
+                        best = t;
+                    }
+                }
+            }
 
-        for (j=0; j<=slices; j++)
-        {
-            glNormal3d(cost1[j]*r0,        sint1[j]*r0,        z0       );
-            glVertex3d(cost1[j]*r0*radius, sint1[j]*r0*radius, z0*radius);
+            cacheSize = ( newCacheSize < FGH_VERTEX_CACHE_SIZE ) ? newCacheSize : FGH_VERTEX_CACHE_SIZE;
+            memcpy( cache, newCache, cacheSize * sizeof( int ) );
         }
 
-    glEnd();
-
-    /* Release sin and cos tables */
+        free( mesh->Indices );
+        mesh->Indices = out;
+        out = NULL;
+    }
 
-    free(sint1);
-    free(cost1);
-    free(sint2);
-    free(cost2);
+    free( remaining );
+    free( first );
+    free( triangles );
+    free( cachePosition );
+    free( vertexScore );
+    free( triangleScore );
+    free( emitted );
+    free( out );
 }
 
 /*
- * Draws a wire sphere
+ * Helpers for the mesh builders
  */
-void FGAPIENTRY glutWireSphere(GLdouble radius, GLint slices, GLint stacks)
+static void fghAllocMeshIndices( SFG_Mesh* mesh, int numTriangles, int numLines )
 {
-    int i,j;
+    mesh->NumIndices = 3 * numTriangles;
+    mesh->Indices = ( GLuint * )malloc( mesh->NumIndices * sizeof( GLuint ) );
+    mesh->NumLineIndices = 2 * numLines;
+    mesh->LineIndices = ( GLuint * )malloc( mesh->NumLineIndices * sizeof( GLuint ) );
 
-    /* Adjust z and radius as stacks and slices are drawn. */
+    if( !mesh->Indices || !mesh->LineIndices )
+        fgError( "Failed to allocate memory in fghAllocMeshIndices" );
+}
 
-    double r;
-    double x,y,z;
+static void fghSetMeshVertex( SFG_Mesh* mesh, int i,
+                              double x, double y, double z,
+                              double nx, double ny, double nz )
+{
+    mesh->Vertices[ 3 * i + 0 ] = ( GLfloat )x;
+    mesh->Vertices[ 3 * i + 1 ] = ( GLfloat )y;
+    mesh->Vertices[ 3 * i + 2 ] = ( GLfloat )z;
+    mesh->Normals [ 3 * i + 0 ] = ( GLfloat )nx;
+    mesh->Normals [ 3 * i + 1 ] = ( GLfloat )ny;
+    mesh->Normals [ 3 * i + 2 ] = ( GLfloat )nz;
+}
 
-    /* Pre-computed circle */
+/*
+ * Draws a unit mesh scaled into place. Scaling changes the length, and
+ * for non-uniform scales the direction, of the transformed normals,
+ * which GL_NORMALIZE puts right again.
+ */
+static void fghDrawScaledMesh( const SFG_Mesh* mesh, GLfloat x, GLfloat y, GLfloat z, GLboolean wire )
+{
+    glPushAttrib( GL_ENABLE_BIT );
+    glEnable( GL_NORMALIZE );
+    glPushMatrix( );
+    glScalef( x, y, z );
+    fgDrawMesh( mesh, wire );
+    glPopMatrix( );
+    glPopAttrib( );
+}
 
-    double *sint1,*cost1;
-    double *sint2,*cost2;
+/*
+ * Builds the mesh of a flat shaded polyhedron from its vertex and face
+ * tables. Every face gets its own copy of its corners, so that they can
+ * carry the face normal; without a normal table the normals are worked
+ * out from the first three corners. Faces must be convex, they are
+ * split into fans.
+ */
+static SFG_Mesh* fghPolyhedronMesh( int type, int numFaces, int numCorners,
+                                    const GLfloat* vertices, const int* faces,
+                                    const GLfloat* normals )
+{
+    const GLdouble key = 0.0;
+    GLuint *tri, *line;
+    int i, j;
+    SFG_Mesh* mesh = fgFindMesh( type, &key, 1 );
 
-    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireSphere" );
+    if( mesh )
+        return mesh;
 
-    fghCircleTable(&sint1,&cost1,-slices  );
-    fghCircleTable(&sint2,&cost2, stacks*2);
+    mesh = fgCreateMesh( type, &key, 1, numFaces * numCorners, GL_FALSE );
+    fghAllocMeshIndices( mesh, numFaces * ( numCorners - 2 ), numFaces * numCorners );
 
-    /* Draw a line loop for each stack */
+    tri = mesh->Indices;
+    line = mesh->LineIndices;
 
-    for (i=1; i<stacks; i++)
+    for( i = 0; i < numFaces; i++ )
     {
-        z = cost2[i];
-        r = sint2[i];
+        const int* face = faces + i * numCorners;
+        const int base = i * numCorners;
+        double n[ 3 ];
 
-        glBegin(GL_LINE_LOOP);
+        if( normals )
+        {
+            n[ 0 ] = normals[ 3 * i + 0 ];
+            n[ 1 ] = normals[ 3 * i + 1 ];
+            n[ 2 ] = normals[ 3 * i + 2 ];
+        }
+        else
+        {
+            const GLfloat* a = vertices + 3 * face[ 0 ];
+            const GLfloat* b = vertices + 3 * face[ 1 ];
+            const GLfloat* c = vertices + 3 * face[ 2 ];
+            double length;
+
+            n[ 0 ] = ( b[ 1 ] - a[ 1 ] ) * ( c[ 2 ] - a[ 2 ] ) - ( b[ 2 ] - a[ 2 ] ) * ( c[ 1 ] - a[ 1 ] );
+            n[ 1 ] = ( b[ 2 ] - a[ 2 ] ) * ( c[ 0 ] - a[ 0 ] ) - ( b[ 0 ] - a[ 0 ] ) * ( c[ 2 ] - a[ 2 ] );
+            n[ 2 ] = ( b[ 0 ] - a[ 0 ] ) * ( c[ 1 ] - a[ 1 ] ) - ( b[ 1 ] - a[ 1 ] ) * ( c[ 0 ] - a[ 0 ] );
+            length = sqrt( n[ 0 ] * n[ 0 ] + n[ 1 ] * n[ 1 ] + n[ 2 ] * n[ 2 ] );
+            n[ 0 ] /= length;
+            n[ 1 ] /= length;
+            n[ 2 ] /= length;
+        }
 
-            for(j=0; j<=slices; j++)
-            {
-                x = cost1[j];
-                y = sint1[j];
+        for( j = 0; j < numCorners; j++ )
+        {
+            const GLfloat* v = vertices + 3 * face[ j ];
 
-                glNormal3d(x,y,z);
-                glVertex3d(x*r*radius,y*r*radius,z*radius);
-            }
+            fghSetMeshVertex( mesh, base + j, v[ 0 ], v[ 1 ], v[ 2 ], n[ 0 ], n[ 1 ], n[ 2 ] );
 
-        glEnd();
+            *line++ = base + j;
+            *line++ = base + ( j + 1 ) % numCorners;
+
+            if( j >= 2 )
+            {
+                *tri++ = base;
+                *tri++ = base + j - 1;
+                *tri++ = base + j;
+            }
+        }
     }
 
-    /* Draw a line loop for each slice */
+    return mesh;
+}
 
-    for (i=0; i<slices; i++)
-    {
-        glBegin(GL_LINE_STRIP);
 
-            for(j=0; j<=stacks; j++)
-            {
-                x = cost1[i]*sint2[j];
-                y = sint1[i]*sint2[j];
-                z = cost2[j];
+/* -- INTERFACE FUNCTIONS -------------------------------------------------- */
 
-                glNormal3d(x,y,z);
-                glVertex3d(x*radius,y*radius,z*radius);
-            }
+/*
+ * The cube, as contributed by Andreas Umbach <marvin@dataway.ch>, in tables.
+ * It is built at unit size and scaled into place.
+ */
+static GLfloat cube_r[8][3] = {
+    {  0.5f,  0.5f,  0.5f },
+    { -0.5f,  0.5f,  0.5f },
+    { -0.5f, -0.5f,  0.5f },
+    {  0.5f, -0.5f,  0.5f },
+    {  0.5f, -0.5f, -0.5f },
+    {  0.5f,  0.5f, -0.5f },
+    { -0.5f,  0.5f, -0.5f },
+    { -0.5f, -0.5f, -0.5f }
+};
 
-        glEnd();
-    }
+static int cube_v [6][4] = {
+    { 3, 4, 5, 0 },
+    { 0, 5, 6, 1 },
+    { 0, 1, 2, 3 },
+    { 2, 1, 6, 7 },
+    { 2, 7, 4, 3 },
+    { 7, 6, 5, 4 }
+};
 
-    /* Release sin and cos tables */
+static GLfloat cube_n[6][3] = {
+    {  1.0f,  0.0f,  0.0f },
+    {  0.0f,  1.0f,  0.0f },
+    {  0.0f,  0.0f,  1.0f },
+    { -1.0f,  0.0f,  0.0f },
+    {  0.0f, -1.0f,  0.0f },
+    {  0.0f,  0.0f, -1.0f }
+};
 
-    free(sint1);
-    free(cost1);
-    free(sint2);
-    free(cost2);
+static void fghCube( GLfloat size, GLboolean wire )
+{
+    fghDrawScaledMesh( fghPolyhedronMesh( FG_MESH_CUBE, 6, 4, &cube_r[0][0],
+                                          &cube_v[0][0], &cube_n[0][0] ),
+                       size, size, size, wire );
 }
 
 /*
- * Draws a solid cone
+ * Draws a wireframed cube.
  */
-void FGAPIENTRY glutSolidCone( GLdouble base, GLdouble height, GLint slices, GLint stacks )
+void FGAPIENTRY glutWireCubef( GLfloat dSize )
 {
-    int i,j;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireCubef" );
+    fghCube( dSize, GL_TRUE );
+}
 
-    /* Step in z and radius as stacks are drawn. */
+void FGAPIENTRY glutWireCube( GLdouble dSize )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireCube" );
+    fghCube( ( GLfloat )dSize, GL_TRUE );
+}
 
-    double z0,z1;
-    double r0,r1;
+/*
+ * Draws a solid cube.
+ */
+void FGAPIENTRY glutSolidCubef( GLfloat dSize )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidCubef" );
+    fghCube( dSize, GL_FALSE );
+}
 
-    const double zStep = height / ( ( stacks > 0 ) ? stacks : 1 );
-    const double rStep = base / ( ( stacks > 0 ) ? stacks : 1 );
+void FGAPIENTRY glutSolidCube( GLdouble dSize )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidCube" );
+    fghCube( ( GLfloat )dSize, GL_FALSE );
+}
 
-    /* Scaling factors for vertex normals */
+/*
+ * Compute lookup table of cos and sin values forming a cirle
+ *
+ * Notes:
+ *    It is the responsibility of the caller to free these tables
+ *    The size of the table is (n+1) to form a connected loop
+ *    The last entry is exactly the same as the first
+ *    The sign of n can be flipped to get the reverse loop
+ */
 
-    const double cosn = ( height / sqrt ( height * height + base * base ));
-    const double sinn = ( base   / sqrt ( height * height + base * base ));
+static void fghCircleTable(double **sint,double **cost,const int n)
+{
+    int i;
 
-    /* Pre-computed circle */
+    /* Table size, the sign of n flips the circle direction */
 
-    double *sint,*cost;
+    const int size = abs(n);
 
-    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidCone" );
+    /* Determine the angle between samples */
 
-    fghCircleTable(&sint,&cost,-slices);
+    const double angle = 2*M_PI/(double)( ( n == 0 ) ? 1 : n );
 
-    /* Cover the circular base with a triangle fan... */
+    /* Allocate memory for n samples, plus duplicate of first entry at the end */
 
-    z0 = 0.0;
-    z1 = zStep;
+    *sint = (double *) calloc(sizeof(double), size+1);
+    *cost = (double *) calloc(sizeof(double), size+1);
 
-    r0 = base;
-    r1 = r0 - rStep;
+    /* Bail out if memory allocation fails, fgError never returns */
 
-    glBegin(GL_TRIANGLE_FAN);
+    if (!(*sint) || !(*cost))
+    {
+        free(*sint);
+        free(*cost);
+        fgError("Failed to allocate memory in fghCircleTable");
+    }
 
-        glNormal3d(0.0,0.0,-1.0);
-        glVertex3d(0.0,0.0, z0 );
+    /* Compute cos and sin around the circle */
 
-        for (j=0; j<=slices; j++)
-            glVertex3d(cost[j]*r0, sint[j]*r0, z0);
+    (*sint)[0] = 0.0;
+    (*cost)[0] = 1.0;
 
-    glEnd();
+    for (i=1; i<size; i++)
+    {
+        (*sint)[i] = sin(angle*i);
+        (*cost)[i] = cos(angle*i);
+    }
 
-    /* Cover each stack with a quad strip, except the top stack */
+    /* Last sample is duplicate of the first */
 
-    for( i=0; i<stacks-1; i++ )
-    {
-        glBegin(GL_QUAD_STRIP);
+    (*sint)[size] = (*sint)[0];
+    (*cost)[size] = (*cost)[0];
+}
 
-            for(j=0; j<=slices; j++)
-            {
-                glNormal3d(cost[j]*cosn, sint[j]*cosn, sinn);
-                glVertex3d(cost[j]*r0,   sint[j]*r0,   z0  );
-                glVertex3d(cost[j]*r1,   sint[j]*r1,   z1  );
-            }
+/*
+ * Cached meshes for the round shapes. Spheres, cones and cylinders are
+ * built at unit size and scaled into place through the modelview matrix,
+ * so only the tessellation picks the mesh. Tori have no such symmetry,
+ * and are keyed on their radii as well. All of them carry line indices
+ * for the wireframe versions, and are run through fgOptimizeMesh().
+ */
+#define TRI(a,b,c)  { *tri++ = (a); *tri++ = (b); *tri++ = (c); }
+#define LINE(a,b)   { *line++ = (a); *line++ = (b); }
+
+/*
+ * A unit sphere: the two poles, then stacks-1 rings of slices+1 vertices
+ */
+static SFG_Mesh* fghSphereMesh( GLint slices, GLint stacks )
+{
+    GLdouble keys[ 2 ];
+    double *sint1, *cost1, *sint2, *cost2;
+    int i, j, ring, next;
+    GLuint *tri, *line;
+    SFG_Mesh* mesh;
+
+    keys[ 0 ] = slices;
+    keys[ 1 ] = stacks;
+    mesh = fgFindMesh( FG_MESH_SPHERE, keys, 2 );
+    if( mesh )
+        return mesh;
+
+    mesh = fgCreateMesh( FG_MESH_SPHERE, keys, 2,
+                         2 + ( stacks - 1 ) * ( slices + 1 ), GL_FALSE );
+    fghAllocMeshIndices( mesh, 2 * slices * ( stacks - 1 ),
+                         slices * ( stacks - 1 ) + slices * stacks );
+
+    fghCircleTable( &sint1, &cost1, -slices );
+    fghCircleTable( &sint2, &cost2, stacks * 2 );
+
+    fghSetMeshVertex( mesh, 0, 0.0, 0.0,  1.0, 0.0, 0.0,  1.0 );
+    fghSetMeshVertex( mesh, 1, 0.0, 0.0, -1.0, 0.0, 0.0, -1.0 );
+
+    for( i = 1; i < stacks; i++ )
+        for( j = 0; j <= slices; j++ )
+        {
+            const double x = cost1[ j ] * sint2[ i ];
+            const double y = sint1[ j ] * sint2[ i ];
+            const double z = cost2[ i ];
 
-            z0 = z1; z1 += zStep;
-            r0 = r1; r1 -= rStep;
+            fghSetMeshVertex( mesh, 2 + ( i - 1 ) * ( slices + 1 ) + j,
+                              x, y, z, x, y, z );
+        }
 
-        glEnd();
-    }
+    free( sint1 );
+    free( cost1 );
+    free( sint2 );
+    free( cost2 );
 
-    /* The top stack is covered with individual triangles */
+    tri = mesh->Indices;
+    line = mesh->LineIndices;
 
-    glBegin(GL_TRIANGLES);
+    /* The fans at either pole, and quads between neighbouring rings */
+    ring = 2 + ( stacks - 2 ) * ( slices + 1 );
+    for( j = 0; j < slices; j++ )
+    {
+        TRI( 0, 2 + j + 1, 2 + j );
+        TRI( 1, ring + j, ring + j + 1 );
+    }
 
-        glNormal3d(cost[0]*cosn, sint[0]*cosn, sinn);
+    for( i = 1; i < stacks - 1; i++ )
+    {
+        ring = 2 + ( i - 1 ) * ( slices + 1 );
+        next = ring + slices + 1;
 
-        for (j=0; j<slices; j++)
+        for( j = 0; j < slices; j++ )
         {
-            glVertex3d(cost[j+0]*r0,   sint[j+0]*r0,   z0    );
-            glVertex3d(0,              0,              height);
-            glNormal3d(cost[j+1]*cosn, sint[j+1]*cosn, sinn  );
-            glVertex3d(cost[j+1]*r0,   sint[j+1]*r0,   z0    );
+            TRI( next + j, ring + j, next + j + 1 );
+            TRI( next + j + 1, ring + j, ring + j + 1 );
         }
+    }
+
+    /* The wireframe has a loop for each ring, and a line pole to pole for each slice */
+    for( i = 1; i < stacks; i++ )
+    {
+        ring = 2 + ( i - 1 ) * ( slices + 1 );
+        for( j = 0; j < slices; j++ )
+            LINE( ring + j, ring + j + 1 );
+    }
 
-    glEnd();
+    for( j = 0; j < slices; j++ )
+    {
+        LINE( 0, 2 + j );
+        for( i = 1; i < stacks - 1; i++ )
+        {
+            ring = 2 + ( i - 1 ) * ( slices + 1 );
+            LINE( ring + j, ring + slices + 1 + j );
+        }
+        LINE( 2 + ( stacks - 2 ) * ( slices + 1 ) + j, 1 );
+    }
 
-    /* Release sin and cos tables */
+    fgOptimizeMesh( mesh );
 
-    free(sint);
-    free(cost);
+    return mesh;
 }
 
 /*
- * Draws a wire cone
+ * A cone of unit base radius and height: the base centre and ring, the
+ * stacks rings up the side, then a copy of the apex for each slice so
+ * that it can carry the normal of that slice.
  */
-void FGAPIENTRY glutWireCone( GLdouble base, GLdouble height, GLint slices, GLint stacks)
+static SFG_Mesh* fghConeMesh( GLint slices, GLint stacks )
 {
-    int i,j;
-
-    /* Step in z and radius as stacks are drawn. */
-
-    double z = 0.0;
-    double r = base;
-
-    const double zStep = height / ( ( stacks > 0 ) ? stacks : 1 );
-    const double rStep = base / ( ( stacks > 0 ) ? stacks : 1 );
-
-    /* Scaling factors for vertex normals */
-
-    const double cosn = ( height / sqrt ( height * height + base * base ));
-    const double sinn = ( base   / sqrt ( height * height + base * base ));
+    GLdouble keys[ 2 ];
+    const double len = sqrt( 2.0 );
+    double *sint, *cost;
+    int i, j, side, apex;
+    GLuint *tri, *line;
+    SFG_Mesh* mesh;
 
-    /* Pre-computed circle */
+    keys[ 0 ] = slices;
+    keys[ 1 ] = stacks;
+    mesh = fgFindMesh( FG_MESH_CONE, keys, 2 );
+    if( mesh )
+        return mesh;
 
-    double *sint,*cost;
+    side = 1 + ( slices + 1 );
+    apex = side + stacks * ( slices + 1 );
 
-    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireCone" );
+    mesh = fgCreateMesh( FG_MESH_CONE, keys, 2, apex + slices, GL_FALSE );
+    fghAllocMeshIndices( mesh, 2 * slices * stacks, slices * stacks + slices );
 
-    fghCircleTable(&sint,&cost,-slices);
+    fghCircleTable( &sint, &cost, -slices );
 
-    /* Draw the stacks... */
+    fghSetMeshVertex( mesh, 0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0 );
 
-    for (i=0; i<stacks; i++)
+    for( j = 0; j <= slices; j++ )
     {
-        glBegin(GL_LINE_LOOP);
+        fghSetMeshVertex( mesh, 1 + j, cost[ j ], sint[ j ], 0.0, 0.0, 0.0, -1.0 );
 
-            for( j=0; j<slices; j++ )
-            {
-                glNormal3d(cost[j]*sinn, sint[j]*sinn, cosn);
-                glVertex3d(cost[j]*r,    sint[j]*r,    z   );
-            }
+        for( i = 0; i < stacks; i++ )
+        {
+            const double r = 1.0 - ( double )i / stacks;
 
-        glEnd();
+            fghSetMeshVertex( mesh, side + i * ( slices + 1 ) + j,
+                              cost[ j ] * r, sint[ j ] * r, ( double )i / stacks,
+                              cost[ j ] / len, sint[ j ] / len, 1.0 / len );
+        }
 
-        z += zStep;
-        r -= rStep;
+        if( j < slices )
+            fghSetMeshVertex( mesh, apex + j, 0.0, 0.0, 1.0,
+                              cost[ j ] / len, sint[ j ] / len, 1.0 / len );
     }
 
-    /* Draw the slices */
+    free( sint );
+    free( cost );
+
+    tri = mesh->Indices;
+    line = mesh->LineIndices;
 
-    r = base;
+    for( j = 0; j < slices; j++ )
+    {
+        const int top = side + ( stacks - 1 ) * ( slices + 1 );
 
-    glBegin(GL_LINES);
+        TRI( 0, 1 + j, 1 + j + 1 );
+        TRI( top + j, apex + j, top + j + 1 );
 
-        for (j=0; j<slices; j++)
+        for( i = 0; i < stacks - 1; i++ )
         {
-            glNormal3d(cost[j]*cosn, sint[j]*cosn, sinn  );
-            glVertex3d(cost[j]*r,    sint[j]*r,    0.0   );
-            glVertex3d(0.0,          0.0,          height);
+            const int lower = side + i * ( slices + 1 );
+            const int upper = lower + slices + 1;
+
+            TRI( lower + j, upper + j, lower + j + 1 );
+            TRI( lower + j + 1, upper + j, upper + j + 1 );
         }
+    }
 
-    glEnd();
+    for( i = 0; i < stacks; i++ )
+        for( j = 0; j < slices; j++ )
+            LINE( side + i * ( slices + 1 ) + j, side + i * ( slices + 1 ) + j + 1 );
 
-    /* Release sin and cos tables */
+    for( j = 0; j < slices; j++ )
+        LINE( side + j, apex + j );
 
-    free(sint);
-    free(cost);
-}
+    fgOptimizeMesh( mesh );
 
+    return mesh;
+}
 
 /*
- * Draws a solid cylinder
+ * A cylinder of unit radius and height: the bottom and top caps, each a
+ * centre and a ring, then stacks+1 rings up the side.
  */
-void FGAPIENTRY glutSolidCylinder(GLdouble radius, GLdouble height, GLint slices, GLint stacks)
+static SFG_Mesh* fghCylinderMesh( GLint slices, GLint stacks )
 {
-    int i,j;
-
-    /* Step in z and radius as stacks are drawn. */
-
-    double z0,z1;
-    const double zStep = height / ( ( stacks > 0 ) ? stacks : 1 );
+    GLdouble keys[ 2 ];
+    double *sint, *cost;
+    int i, j, top, side;
+    GLuint *tri, *line;
+    SFG_Mesh* mesh;
 
-    /* Pre-computed circle */
+    keys[ 0 ] = slices;
+    keys[ 1 ] = stacks;
+    mesh = fgFindMesh( FG_MESH_CYLINDER, keys, 2 );
+    if( mesh )
+        return mesh;
 
-    double *sint,*cost;
+    top = 1 + ( slices + 1 );
+    side = 2 * top;
 
-    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidCylinder" );
+    mesh = fgCreateMesh( FG_MESH_CYLINDER, keys, 2,
+                         side + ( stacks + 1 ) * ( slices + 1 ), GL_FALSE );
+    fghAllocMeshIndices( mesh, 2 * slices * ( stacks + 1 ),
+                         slices * ( stacks + 1 ) + slices );
 
-    fghCircleTable(&sint,&cost,-slices);
+    fghCircleTable( &sint, &cost, -slices );
 
-    /* Cover the base and top */
+    fghSetMeshVertex( mesh, 0,   0.0, 0.0, 0.0, 0.0, 0.0, -1.0 );
+    fghSetMeshVertex( mesh, top, 0.0, 0.0, 1.0, 0.0, 0.0,  1.0 );
 
-    glBegin(GL_TRIANGLE_FAN);
-        glNormal3d(0.0, 0.0, -1.0 );
-        glVertex3d(0.0, 0.0,  0.0 );
-        for (j=0; j<=slices; j++)
-          glVertex3d(cost[j]*radius, sint[j]*radius, 0.0);
-    glEnd();
+    for( j = 0; j <= slices; j++ )
+    {
+        fghSetMeshVertex( mesh, 1 + j,       cost[ j ], sint[ j ], 0.0, 0.0, 0.0, -1.0 );
+        fghSetMeshVertex( mesh, top + 1 + j, cost[ j ], sint[ j ], 1.0, 0.0, 0.0,  1.0 );
 
-    glBegin(GL_TRIANGLE_FAN);
-        glNormal3d(0.0, 0.0, 1.0   );
-        glVertex3d(0.0, 0.0, height);
-        for (j=slices; j>=0; j--)
-          glVertex3d(cost[j]*radius, sint[j]*radius, height);
-    glEnd();
+        for( i = 0; i <= stacks; i++ )
+            fghSetMeshVertex( mesh, side + i * ( slices + 1 ) + j,
+                              cost[ j ], sint[ j ], ( double )i / stacks,
+                              cost[ j ], sint[ j ], 0.0 );
+    }
 
-    /* Do the stacks */
+    free( sint );
+    free( cost );
 
-    z0 = 0.0;
-    z1 = zStep;
+    tri = mesh->Indices;
+    line = mesh->LineIndices;
 
-    for (i=1; i<=stacks; i++)
+    for( j = 0; j < slices; j++ )
     {
-        if (i==stacks)
-            z1 = height;
+        TRI( 0, 1 + j, 1 + j + 1 );
+        TRI( top, top + 1 + j + 1, top + 1 + j );
 
-        glBegin(GL_QUAD_STRIP);
-            for (j=0; j<=slices; j++ )
-            {
-                glNormal3d(cost[j],        sint[j],        0.0 );
-                glVertex3d(cost[j]*radius, sint[j]*radius, z0  );
-                glVertex3d(cost[j]*radius, sint[j]*radius, z1  );
-            }
-        glEnd();
+        for( i = 0; i < stacks; i++ )
+        {
+            const int lower = side + i * ( slices + 1 );
+            const int upper = lower + slices + 1;
 
-        z0 = z1; z1 += zStep;
+            TRI( lower + j, upper + j, lower + j + 1 );
+            TRI( lower + j + 1, upper + j, upper + j + 1 );
+        }
     }
 
-    /* Release sin and cos tables */
+    for( i = 0; i <= stacks; i++ )
+        for( j = 0; j < slices; j++ )
+            LINE( side + i * ( slices + 1 ) + j, side + i * ( slices + 1 ) + j + 1 );
 
-    free(sint);
-    free(cost);
+    for( j = 0; j < slices; j++ )
+        LINE( side + j, side + stacks * ( slices + 1 ) + j );
+
+    fgOptimizeMesh( mesh );
+
+    return mesh;
 }
 
 /*
- * Draws a wire cylinder
+ * A torus: an (nSides+1) by (nRings+1) grid, the last row and column
+ * repeating the first so that the seams need no special casing. The
+ * mesh is cached by its grid size alone; the normals and indices do not
+ * depend on the radii, and fghPlaceTorus() fills in the positions.
  */
-void FGAPIENTRY glutWireCylinder(GLdouble radius, GLdouble height, GLint slices, GLint stacks)
+static SFG_Mesh* fghTorusMesh( GLint nSides, GLint nRings )
 {
-    int i,j;
+    GLdouble keys[ 2 ];
+    const double dpsi =  2.0 * M_PI / ( double )nRings;
+    const double dphi = -2.0 * M_PI / ( double )nSides;
+    const int n = nSides + 1;
+    int i, j;
+    GLuint *tri, *line;
+    SFG_Mesh* mesh;
+
+    keys[ 0 ] = nSides;
+    keys[ 1 ] = nRings;
+    mesh = fgFindMesh( FG_MESH_TORUS, keys, 2 );
+    if( mesh )
+        return mesh;
+
+    mesh = fgCreateMesh( FG_MESH_TORUS, keys, 2, n * ( nRings + 1 ), GL_FALSE );
+    fghAllocMeshIndices( mesh, 2 * nSides * nRings, 2 * nSides * nRings );
+
+    for( j = 0; j <= nRings; j++ )
+    {
+        const double cpsi = cos( dpsi * j );
+        const double spsi = sin( dpsi * j );
 
-    /* Step in z and radius as stacks are drawn. */
+        for( i = 0; i <= nSides; i++ )
+        {
+            const double cphi = cos( dphi * i );
+            const double sphi = sin( dphi * i );
 
-          double z = 0.0;
-    const double zStep = height / ( ( stacks > 0 ) ? stacks : 1 );
+            fghSetMeshVertex( mesh, j * n + i, 0.0, 0.0, 0.0,
+                              cpsi * cphi, spsi * cphi, sphi );
+        }
+    }
 
-    /* Pre-computed circle */
+    /* Every vertex starts at the origin, which is right for radii of 0 */
+    mesh->Sizes[ 0 ] = mesh->Sizes[ 1 ] = 0.0;
 
-    double *sint,*cost;
+    tri = mesh->Indices;
+    line = mesh->LineIndices;
 
-    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireCylinder" );
+    for( j = 0; j < nRings; j++ )
+        for( i = 0; i < nSides; i++ )
+        {
+            const int offset = j * n + i;
 
-    fghCircleTable(&sint,&cost,-slices);
+            TRI( offset, offset + 1, offset + n + 1 );
+            TRI( offset, offset + n + 1, offset + n );
+            LINE( offset, offset + n );
+            LINE( offset, offset + 1 );
+        }
 
-    /* Draw the stacks... */
+    fgOptimizeMesh( mesh );
 
-    for (i=0; i<=stacks; i++)
-    {
-        if (i==stacks)
-            z = height;
+    return mesh;
+}
 
-        glBegin(GL_LINE_LOOP);
+/*
+ * Moves the torus vertices out to the given radii. Each one sits at
+ * iradius along its normal from the centre of the tube, which is at
+ * oradius along the ring direction; the work is skipped while the radii
+ * stay the same as last time.
+ */
+static void fghPlaceTorus( SFG_Mesh* mesh, GLfloat iradius, GLfloat oradius,
+                           GLint nSides, GLint nRings )
+{
+    const double dpsi = 2.0 * M_PI / ( double )nRings;
+    const int n = nSides + 1;
+    int i, j;
 
-            for( j=0; j<slices; j++ )
-            {
-                glNormal3d(cost[j],        sint[j],        0.0);
-                glVertex3d(cost[j]*radius, sint[j]*radius, z  );
-            }
+    if( ( mesh->Sizes[ 0 ] == iradius ) && ( mesh->Sizes[ 1 ] == oradius ) )
+        return;
 
-        glEnd();
+    for( j = 0; j <= nRings; j++ )
+    {
+        const double x = cos( dpsi * j ) * oradius;
+        const double y = sin( dpsi * j ) * oradius;
 
-        z += zStep;
+        for( i = j * n; i < ( j + 1 ) * n; i++ )
+        {
+            mesh->Vertices[ 3 * i + 0 ] = ( GLfloat )( x + mesh->Normals[ 3 * i + 0 ] * iradius );
+            mesh->Vertices[ 3 * i + 1 ] = ( GLfloat )( y + mesh->Normals[ 3 * i + 1 ] * iradius );
+            mesh->Vertices[ 3 * i + 2 ] = ( GLfloat )(     mesh->Normals[ 3 * i + 2 ] * iradius );
+        }
     }
 
-    /* Draw the slices */
+    mesh->Sizes[ 0 ] = iradius;
+    mesh->Sizes[ 1 ] = oradius;
+}
 
-    glBegin(GL_LINES);
+#undef TRI
+#undef LINE
 
-        for (j=0; j<slices; j++)
-        {
-            glNormal3d(cost[j],        sint[j],        0.0   );
-            glVertex3d(cost[j]*radius, sint[j]*radius, 0.0   );
-            glVertex3d(cost[j]*radius, sint[j]*radius, height);
-        }
+/*
+ * Level of detail selection for the "Auto" shapes. The slice counts form
+ * a geometric ladder, so a scene full of objects at different distances
+ * still only uses a handful of cached meshes per shape.
+ */
+static const GLint fghLODSlices[] = { 6, 8, 12, 16, 24, 32, 48, 64, 96, 128 };
+#define  FGH_LOD_STEPS  ( int )( sizeof( fghLODSlices ) / sizeof( fghLODSlices[ 0 ] ) )
 
-    glEnd();
+/*
+ * Estimates how many pixels a unit length at the modelview origin covers,
+ * from the current matrices and viewport, using the near side of a
+ * bounding sphere of the given radius. Returns a negative value when the
+ * eye is inside or behind that sphere, and the size cannot be bounded.
+ */
+static GLdouble fghPixelsPerUnit( GLdouble boundingRadius )
+{
+    GLdouble modelview[ 16 ], projection[ 16 ];
+    GLdouble scale = 0.0, w, dw, pixels;
+    GLint viewport[ 4 ];
+    int i;
 
-    /* Release sin and cos tables */
+    glGetDoublev( GL_MODELVIEW_MATRIX, modelview );
+    glGetDoublev( GL_PROJECTION_MATRIX, projection );
+    glGetIntegerv( GL_VIEWPORT, viewport );
 
-    free(sint);
-    free(cost);
+    /* The largest scale the modelview matrix applies along any axis */
+    for( i = 0; i < 3; i++ )
+    {
+        const GLdouble s = modelview[ 4 * i + 0 ] * modelview[ 4 * i + 0 ] +
+                           modelview[ 4 * i + 1 ] * modelview[ 4 * i + 1 ] +
+                           modelview[ 4 * i + 2 ] * modelview[ 4 * i + 2 ];
+        if( s > scale )
+            scale = s;
+    }
+    scale = sqrt( scale );
+
+    /*
+     * The clip space w of the origin, and the most it can shrink across
+     * the bounding sphere; w is constant under an orthographic projection.
+     */
+    w = projection[ 3 ] * modelview[ 12 ] + projection[ 7 ] * modelview[ 13 ] +
+        projection[ 11 ] * modelview[ 14 ] + projection[ 15 ];
+    dw = sqrt( projection[ 3 ] * projection[ 3 ] + projection[ 7 ] * projection[ 7 ] +
+               projection[ 11 ] * projection[ 11 ] ) * boundingRadius * scale;
+
+    if( w - dw <= 0.0 )
+        return -1.0;
+
+    pixels = fabs( projection[ 0 ] ) * viewport[ 2 ];
+    if( fabs( projection[ 5 ] ) * viewport[ 3 ] > pixels )
+        pixels = fabs( projection[ 5 ] ) * viewport[ 3 ];
+
+    return scale * pixels * 0.5 / ( w - dw );
 }
 
 /*
- * Draws a wire torus
+ * Picks the smallest step of the ladder that keeps a circle of the given
+ * radius within pixelError of its tessellation. A circle of radius r drawn
+ * with n segments strays from the true curve by r * ( 1 - cos( pi / n ) ).
  */
-void FGAPIENTRY glutWireTorus( GLdouble dInnerRadius, GLdouble dOuterRadius, GLint nSides, GLint nRings )
+static GLint fghAutoSlices( GLdouble radius, GLdouble boundingRadius, GLdouble pixelError )
 {
-  double  iradius = dInnerRadius, oradius = dOuterRadius, phi, psi, dpsi, dphi;
-  double *vertex, *normal;
-  int    i, j;
-  double spsi, cpsi, sphi, cphi ;
+    const GLdouble pixelsPerUnit = fghPixelsPerUnit( fabs( boundingRadius ) );
+    GLdouble radiusPixels, needed;
+    int i;
 
-  FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireTorus" );
+    if( ( pixelsPerUnit < 0.0 ) || ( pixelError <= 0.0 ) )
+        return fghLODSlices[ FGH_LOD_STEPS - 1 ];
 
-  if ( nSides < 1 ) nSides = 1;
-  if ( nRings < 1 ) nRings = 1;
+    radiusPixels = fabs( radius ) * pixelsPerUnit;
+    if( pixelError >= radiusPixels )
+        return fghLODSlices[ 0 ];
 
-  /* Allocate the vertices array */
-  vertex = (double *)calloc( sizeof(double), 3 * nSides * nRings );
-  normal = (double *)calloc( sizeof(double), 3 * nSides * nRings );
+    needed = M_PI / acos( 1.0 - pixelError / radiusPixels );
 
-  glPushMatrix();
+    for( i = 0; i < FGH_LOD_STEPS - 1; i++ )
+        if( fghLODSlices[ i ] >= needed )
+            break;
 
-  dpsi =  2.0 * M_PI / (double)nRings ;
-  dphi = -2.0 * M_PI / (double)nSides ;
-  psi  = 0.0;
+    return fghLODSlices[ i ];
+}
 
-  for( j=0; j<nRings; j++ )
-  {
-    cpsi = cos ( psi ) ;
-    spsi = sin ( psi ) ;
-    phi = 0.0;
+/*
+ * The round shapes are drawn from the cached meshes above. The single
+ * precision versions do the work, the double ones are thin wrappers.
+ */
+static void fghSphere( GLfloat radius, GLint slices, GLint stacks, GLboolean wire )
+{
+    /* Anything less has no area to draw */
+    if( ( slices < 1 ) || ( stacks < 2 ) )
+        return;
 
-    for( i=0; i<nSides; i++ )
-    {
-      int offset = 3 * ( j * nSides + i ) ;
-      cphi = cos ( phi ) ;
-      sphi = sin ( phi ) ;
-      *(vertex + offset + 0) = cpsi * ( oradius + cphi * iradius ) ;
-      *(vertex + offset + 1) = spsi * ( oradius + cphi * iradius ) ;
-      *(vertex + offset + 2) =                    sphi * iradius  ;
-      *(normal + offset + 0) = cpsi * cphi ;
-      *(normal + offset + 1) = spsi * cphi ;
-      *(normal + offset + 2) =        sphi ;
-      phi += dphi;
-    }
+    fghDrawScaledMesh( fghSphereMesh( slices, stacks ), radius, radius, radius, wire );
+}
 
-    psi += dpsi;
-  }
+static void fghCone( GLfloat base, GLfloat height, GLint slices, GLint stacks, GLboolean wire )
+{
+    if( slices < 1 )
+        return;
+    if( stacks < 1 )
+        stacks = 1;
 
-  for( i=0; i<nSides; i++ )
-  {
-    glBegin( GL_LINE_LOOP );
+    fghDrawScaledMesh( fghConeMesh( slices, stacks ), base, base, height, wire );
+}
 
-    for( j=0; j<nRings; j++ )
-    {
-      int offset = 3 * ( j * nSides + i ) ;
-      glNormal3dv( normal + offset );
-      glVertex3dv( vertex + offset );
-    }
+static void fghCylinder( GLfloat radius, GLfloat height, GLint slices, GLint stacks, GLboolean wire )
+{
+    if( slices < 1 )
+        return;
+    if( stacks < 1 )
+        stacks = 1;
 
-    glEnd();
-  }
+    fghDrawScaledMesh( fghCylinderMesh( slices, stacks ), radius, radius, height, wire );
+}
 
-  for( j=0; j<nRings; j++ )
-  {
-    glBegin(GL_LINE_LOOP);
+static void fghTorus( GLfloat iradius, GLfloat oradius, GLint nSides, GLint nRings, GLboolean wire )
+{
+    SFG_Mesh* mesh;
 
-    for( i=0; i<nSides; i++ )
-    {
-      int offset = 3 * ( j * nSides + i ) ;
-      glNormal3dv( normal + offset );
-      glVertex3dv( vertex + offset );
-    }
+    if ( nSides < 1 ) nSides = 1;
+    if ( nRings < 1 ) nRings = 1;
 
-    glEnd();
-  }
+    mesh = fghTorusMesh( nSides, nRings );
+    fghPlaceTorus( mesh, iradius, oradius, nSides, nRings );
+    fgDrawMesh( mesh, wire );
+}
+
+/*
+ * Draws a solid sphere
+ */
+void FGAPIENTRY glutSolidSpheref( GLfloat radius, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidSpheref" );
+    fghSphere( radius, slices, stacks, GL_FALSE );
+}
 
-  free ( vertex ) ;
-  free ( normal ) ;
-  glPopMatrix();
+void FGAPIENTRY glutSolidSphere( GLdouble radius, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidSphere" );
+    fghSphere( ( GLfloat )radius, slices, stacks, GL_FALSE );
 }
 
 /*
- * Draws a solid torus
+ * Draws a wire sphere
  */
-void FGAPIENTRY glutSolidTorus( GLdouble dInnerRadius, GLdouble dOuterRadius, GLint nSides, GLint nRings )
+void FGAPIENTRY glutWireSpheref( GLfloat radius, GLint slices, GLint stacks )
 {
-  double  iradius = dInnerRadius, oradius = dOuterRadius, phi, psi, dpsi, dphi;
-  double *vertex, *normal;
-  int    i, j;
-  double spsi, cpsi, sphi, cphi ;
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireSpheref" );
+    fghSphere( radius, slices, stacks, GL_TRUE );
+}
 
-  FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidTorus" );
+void FGAPIENTRY glutWireSphere( GLdouble radius, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireSphere" );
+    fghSphere( ( GLfloat )radius, slices, stacks, GL_TRUE );
+}
 
-  if ( nSides < 1 ) nSides = 1;
-  if ( nRings < 1 ) nRings = 1;
+/*
+ * Draws a solid cone
+ */
+void FGAPIENTRY glutSolidConef( GLfloat base, GLfloat height, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidConef" );
+    fghCone( base, height, slices, stacks, GL_FALSE );
+}
 
-  /* Increment the number of sides and rings to allow for one more point than surface */
-  nSides ++ ;
-  nRings ++ ;
+void FGAPIENTRY glutSolidCone( GLdouble base, GLdouble height, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidCone" );
+    fghCone( ( GLfloat )base, ( GLfloat )height, slices, stacks, GL_FALSE );
+}
 
-  /* Allocate the vertices array */
-  vertex = (double *)calloc( sizeof(double), 3 * nSides * nRings );
-  normal = (double *)calloc( sizeof(double), 3 * nSides * nRings );
+/*
+ * Draws a wire cone
+ */
+void FGAPIENTRY glutWireConef( GLfloat base, GLfloat height, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireConef" );
+    fghCone( base, height, slices, stacks, GL_TRUE );
+}
 
-  glPushMatrix();
+void FGAPIENTRY glutWireCone( GLdouble base, GLdouble height, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireCone" );
+    fghCone( ( GLfloat )base, ( GLfloat )height, slices, stacks, GL_TRUE );
+}
 
-  dpsi =  2.0 * M_PI / (double)(nRings - 1) ;
-  dphi = -2.0 * M_PI / (double)(nSides - 1) ;
-  psi  = 0.0;
+/*
+ * Draws a solid cylinder
+ */
+void FGAPIENTRY glutSolidCylinderf( GLfloat radius, GLfloat height, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidCylinderf" );
+    fghCylinder( radius, height, slices, stacks, GL_FALSE );
+}
 
-  for( j=0; j<nRings; j++ )
-  {
-    cpsi = cos ( psi ) ;
-    spsi = sin ( psi ) ;
-    phi = 0.0;
+void FGAPIENTRY glutSolidCylinder( GLdouble radius, GLdouble height, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidCylinder" );
+    fghCylinder( ( GLfloat )radius, ( GLfloat )height, slices, stacks, GL_FALSE );
+}
 
-    for( i=0; i<nSides; i++ )
-    {
-      int offset = 3 * ( j * nSides + i ) ;
-      cphi = cos ( phi ) ;
-      sphi = sin ( phi ) ;
-      *(vertex + offset + 0) = cpsi * ( oradius + cphi * iradius ) ;
-      *(vertex + offset + 1) = spsi * ( oradius + cphi * iradius ) ;
-      *(vertex + offset + 2) =                    sphi * iradius  ;
-      *(normal + offset + 0) = cpsi * cphi ;
-      *(normal + offset + 1) = spsi * cphi ;
-      *(normal + offset + 2) =        sphi ;
-      phi += dphi;
-    }
+/*
+ * Draws a wire cylinder
+ */
+void FGAPIENTRY glutWireCylinderf( GLfloat radius, GLfloat height, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireCylinderf" );
+    fghCylinder( radius, height, slices, stacks, GL_TRUE );
+}
 
-    psi += dpsi;
-  }
+void FGAPIENTRY glutWireCylinder( GLdouble radius, GLdouble height, GLint slices, GLint stacks )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireCylinder" );
+    fghCylinder( ( GLfloat )radius, ( GLfloat )height, slices, stacks, GL_TRUE );
+}
 
-    glBegin( GL_QUADS );
-  for( i=0; i<nSides-1; i++ )
-  {
-    for( j=0; j<nRings-1; j++ )
-    {
-      int offset = 3 * ( j * nSides + i ) ;
-      glNormal3dv( normal + offset );
-      glVertex3dv( vertex + offset );
-      glNormal3dv( normal + offset + 3 );
-      glVertex3dv( vertex + offset + 3 );
-      glNormal3dv( normal + offset + 3 * nSides + 3 );
-      glVertex3dv( vertex + offset + 3 * nSides + 3 );
-      glNormal3dv( normal + offset + 3 * nSides );
-      glVertex3dv( vertex + offset + 3 * nSides );
-    }
-  }
+/*
+ * Draws a wire torus
+ */
+void FGAPIENTRY glutWireTorusf( GLfloat dInnerRadius, GLfloat dOuterRadius, GLint nSides, GLint nRings )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireTorusf" );
+    fghTorus( dInnerRadius, dOuterRadius, nSides, nRings, GL_TRUE );
+}
 
-  glEnd();
+void FGAPIENTRY glutWireTorus( GLdouble dInnerRadius, GLdouble dOuterRadius, GLint nSides, GLint nRings )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireTorus" );
+    fghTorus( ( GLfloat )dInnerRadius, ( GLfloat )dOuterRadius, nSides, nRings, GL_TRUE );
+}
 
-  free ( vertex ) ;
-  free ( normal ) ;
-  glPopMatrix();
+/*
+ * Draws a solid torus
+ */
+void FGAPIENTRY glutSolidTorusf( GLfloat dInnerRadius, GLfloat dOuterRadius, GLint nSides, GLint nRings )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidTorusf" );
+    fghTorus( dInnerRadius, dOuterRadius, nSides, nRings, GL_FALSE );
+}
+
+void FGAPIENTRY glutSolidTorus( GLdouble dInnerRadius, GLdouble dOuterRadius, GLint nSides, GLint nRings )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidTorus" );
+    fghTorus( ( GLfloat )dInnerRadius, ( GLfloat )dOuterRadius, nSides, nRings, GL_FALSE );
 }
 
 /*
- *
+ * Magic Numbers:  It is possible to create a dodecahedron by attaching two pentagons to each face of
+ * of a cube.  The coordinates of the points are:
+ *   (+-x,0, z); (+-1, 1, 1); (0, z, x )
+ * where x = (-1 + sqrt(5))/2, z = (1 + sqrt(5))/2  or
+ *       x = 0.61803398875 and z = 1.61803398875.
  */
+static GLfloat dodec_r[20][3] = {
+    {  0.0f,            1.61803398875f,  0.61803398875f },
+    { -1.0f,            1.0f,            1.0f           },
+    { -0.61803398875f,  0.0f,            1.61803398875f },
+    {  0.61803398875f,  0.0f,            1.61803398875f },
+    {  1.0f,            1.0f,            1.0f           },
+    {  0.0f,            1.61803398875f, -0.61803398875f },
+    {  1.0f,            1.0f,           -1.0f           },
+    {  0.61803398875f,  0.0f,           -1.61803398875f },
+    { -0.61803398875f,  0.0f,           -1.61803398875f },
+    { -1.0f,            1.0f,           -1.0f           },
+    {  0.0f,           -1.61803398875f,  0.61803398875f },
+    {  1.0f,           -1.0f,            1.0f           },
+    { -1.0f,           -1.0f,            1.0f           },
+    {  0.0f,           -1.61803398875f, -0.61803398875f },
+    { -1.0f,           -1.0f,           -1.0f           },
+    {  1.0f,           -1.0f,           -1.0f           },
+    {  1.61803398875f, -0.61803398875f,  0.0f           },
+    {  1.61803398875f,  0.61803398875f,  0.0f           },
+    { -1.61803398875f,  0.61803398875f,  0.0f           },
+    { -1.61803398875f, -0.61803398875f,  0.0f           }
+};
+
+static int dodec_v [12][5] = {
+    {  0,  1,  2,  3,  4 },
+    {  5,  6,  7,  8,  9 },
+    { 10, 11,  3,  2, 12 },
+    { 13, 14,  8,  7, 15 },
+    {  3, 11, 16, 17,  4 },
+    {  2,  1, 18, 19, 12 },
+    {  7,  6, 17, 16, 15 },
+    {  8, 14, 19, 18,  9 },
+    { 17,  6,  5,  0,  4 },
+    { 16, 11, 10, 13, 15 },
+    { 18,  1,  0,  5,  9 },
+    { 19, 14, 13, 10, 12 }
+};
+
+static GLfloat dodec_n[12][3] = {
+    {  0.0f,             0.525731112119f,  0.850650808354f },
+    {  0.0f,             0.525731112119f, -0.850650808354f },
+    {  0.0f,            -0.525731112119f,  0.850650808354f },
+    {  0.0f,            -0.525731112119f, -0.850650808354f },
+    {  0.850650808354f,  0.0f,             0.525731112119f },
+    { -0.850650808354f,  0.0f,             0.525731112119f },
+    {  0.850650808354f,  0.0f,            -0.525731112119f },
+    { -0.850650808354f,  0.0f,            -0.525731112119f },
+    {  0.525731112119f,  0.850650808354f,  0.0f            },
+    {  0.525731112119f, -0.850650808354f,  0.0f            },
+    { -0.525731112119f,  0.850650808354f,  0.0f            },
+    { -0.525731112119f, -0.850650808354f,  0.0f            }
+};
+
 void FGAPIENTRY glutWireDodecahedron( void )
 {
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireDodecahedron" );
 
-  /* Magic Numbers:  It is possible to create a dodecahedron by attaching two pentagons to each face of
-   * of a cube.  The coordinates of the points are:
-   *   (+-x,0, z); (+-1, 1, 1); (0, z, x )
-   * where x = (-1 + sqrt(5))/2, z = (1 + sqrt(5))/2  or
-   *       x = 0.61803398875 and z = 1.61803398875.
-   */
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d (  0.0,  0.525731112119,  0.850650808354 ) ; glVertex3d (  0.0,  1.61803398875,  0.61803398875 ) ; glVertex3d ( -1.0,  1.0,  1.0 ) ; glVertex3d ( -0.61803398875, 0.0,  1.61803398875 ) ; glVertex3d (  0.61803398875, 0.0,  1.61803398875 ) ; glVertex3d (  1.0,  1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d (  0.0,  0.525731112119, -0.850650808354 ) ; glVertex3d (  0.0,  1.61803398875, -0.61803398875 ) ; glVertex3d (  1.0,  1.0, -1.0 ) ; glVertex3d (  0.61803398875, 0.0, -1.61803398875 ) ; glVertex3d ( -0.61803398875, 0.0, -1.61803398875 ) ; glVertex3d ( -1.0,  1.0, -1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d (  0.0, -0.525731112119,  0.850650808354 ) ; glVertex3d (  0.0, -1.61803398875,  0.61803398875 ) ; glVertex3d (  1.0, -1.0,  1.0 ) ; glVertex3d (  0.61803398875, 0.0,  1.61803398875 ) ; glVertex3d ( -0.61803398875, 0.0,  1.61803398875 ) ; glVertex3d ( -1.0, -1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d (  0.0, -0.525731112119, -0.850650808354 ) ; glVertex3d (  0.0, -1.61803398875, -0.61803398875 ) ; glVertex3d ( -1.0, -1.0, -1.0 ) ; glVertex3d ( -0.61803398875, 0.0, -1.61803398875 ) ; glVertex3d (  0.61803398875, 0.0, -1.61803398875 ) ; glVertex3d (  1.0, -1.0, -1.0 ) ;
-  glEnd () ;
-
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d (  0.850650808354,  0.0,  0.525731112119 ) ; glVertex3d (  0.61803398875,  0.0,  1.61803398875 ) ; glVertex3d (  1.0, -1.0,  1.0 ) ; glVertex3d (  1.61803398875, -0.61803398875, 0.0 ) ; glVertex3d (  1.61803398875,  0.61803398875, 0.0 ) ; glVertex3d (  1.0,  1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d ( -0.850650808354,  0.0,  0.525731112119 ) ; glVertex3d ( -0.61803398875,  0.0,  1.61803398875 ) ; glVertex3d ( -1.0,  1.0,  1.0 ) ; glVertex3d ( -1.61803398875,  0.61803398875, 0.0 ) ; glVertex3d ( -1.61803398875, -0.61803398875, 0.0 ) ; glVertex3d ( -1.0, -1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d (  0.850650808354,  0.0, -0.525731112119 ) ; glVertex3d (  0.61803398875,  0.0, -1.61803398875 ) ; glVertex3d (  1.0,  1.0, -1.0 ) ; glVertex3d (  1.61803398875,  0.61803398875, 0.0 ) ; glVertex3d (  1.61803398875, -0.61803398875, 0.0 ) ; glVertex3d (  1.0, -1.0, -1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d ( -0.850650808354,  0.0, -0.525731112119 ) ; glVertex3d ( -0.61803398875,  0.0, -1.61803398875 ) ; glVertex3d ( -1.0, -1.0, -1.0 ) ; glVertex3d ( -1.61803398875, -0.61803398875, 0.0 ) ; glVertex3d ( -1.61803398875,  0.61803398875, 0.0 ) ; glVertex3d ( -1.0,  1.0, -1.0 ) ;
-  glEnd () ;
-
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d (  0.525731112119,  0.850650808354,  0.0 ) ; glVertex3d (  1.61803398875,  0.61803398875,  0.0 ) ; glVertex3d (  1.0,  1.0, -1.0 ) ; glVertex3d ( 0.0,  1.61803398875, -0.61803398875 ) ; glVertex3d ( 0.0,  1.61803398875,  0.61803398875 ) ; glVertex3d (  1.0,  1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d (  0.525731112119, -0.850650808354,  0.0 ) ; glVertex3d (  1.61803398875, -0.61803398875,  0.0 ) ; glVertex3d (  1.0, -1.0,  1.0 ) ; glVertex3d ( 0.0, -1.61803398875,  0.61803398875 ) ; glVertex3d ( 0.0, -1.61803398875, -0.61803398875 ) ; glVertex3d (  1.0, -1.0, -1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d ( -0.525731112119,  0.850650808354,  0.0 ) ; glVertex3d ( -1.61803398875,  0.61803398875,  0.0 ) ; glVertex3d ( -1.0,  1.0,  1.0 ) ; glVertex3d ( 0.0,  1.61803398875,  0.61803398875 ) ; glVertex3d ( 0.0,  1.61803398875, -0.61803398875 ) ; glVertex3d ( -1.0,  1.0, -1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_LINE_LOOP ) ;
-  glNormal3d ( -0.525731112119, -0.850650808354,  0.0 ) ; glVertex3d ( -1.61803398875, -0.61803398875,  0.0 ) ; glVertex3d ( -1.0, -1.0, -1.0 ) ; glVertex3d ( 0.0, -1.61803398875, -0.61803398875 ) ; glVertex3d ( 0.0, -1.61803398875,  0.61803398875 ) ; glVertex3d ( -1.0, -1.0,  1.0 ) ;
-  glEnd () ;
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_DODECAHEDRON, 12, 5, &dodec_r[0][0], &dodec_v[0][0], &dodec_n[0][0] ), GL_TRUE ) ;
 }
 
 /*
@@ -817,71 +1302,48 @@ void FGAPIENTRY glutSolidDodecahedron( void )
 {
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidDodecahedron" );
 
-  /* Magic Numbers:  It is possible to create a dodecahedron by attaching two pentagons to each face of
-   * of a cube.  The coordinates of the points are:
-   *   (+-x,0, z); (+-1, 1, 1); (0, z, x )
-   * where x = (-1 + sqrt(5))/2, z = (1 + sqrt(5))/2 or
-   *       x = 0.61803398875 and z = 1.61803398875.
-   */
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d (  0.0,  0.525731112119,  0.850650808354 ) ; glVertex3d (  0.0,  1.61803398875,  0.61803398875 ) ; glVertex3d ( -1.0,  1.0,  1.0 ) ; glVertex3d ( -0.61803398875, 0.0,  1.61803398875 ) ; glVertex3d (  0.61803398875, 0.0,  1.61803398875 ) ; glVertex3d (  1.0,  1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d (  0.0,  0.525731112119, -0.850650808354 ) ; glVertex3d (  0.0,  1.61803398875, -0.61803398875 ) ; glVertex3d (  1.0,  1.0, -1.0 ) ; glVertex3d (  0.61803398875, 0.0, -1.61803398875 ) ; glVertex3d ( -0.61803398875, 0.0, -1.61803398875 ) ; glVertex3d ( -1.0,  1.0, -1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d (  0.0, -0.525731112119,  0.850650808354 ) ; glVertex3d (  0.0, -1.61803398875,  0.61803398875 ) ; glVertex3d (  1.0, -1.0,  1.0 ) ; glVertex3d (  0.61803398875, 0.0,  1.61803398875 ) ; glVertex3d ( -0.61803398875, 0.0,  1.61803398875 ) ; glVertex3d ( -1.0, -1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d (  0.0, -0.525731112119, -0.850650808354 ) ; glVertex3d (  0.0, -1.61803398875, -0.61803398875 ) ; glVertex3d ( -1.0, -1.0, -1.0 ) ; glVertex3d ( -0.61803398875, 0.0, -1.61803398875 ) ; glVertex3d (  0.61803398875, 0.0, -1.61803398875 ) ; glVertex3d (  1.0, -1.0, -1.0 ) ;
-  glEnd () ;
-
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d (  0.850650808354,  0.0,  0.525731112119 ) ; glVertex3d (  0.61803398875,  0.0,  1.61803398875 ) ; glVertex3d (  1.0, -1.0,  1.0 ) ; glVertex3d (  1.61803398875, -0.61803398875, 0.0 ) ; glVertex3d (  1.61803398875,  0.61803398875, 0.0 ) ; glVertex3d (  1.0,  1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d ( -0.850650808354,  0.0,  0.525731112119 ) ; glVertex3d ( -0.61803398875,  0.0,  1.61803398875 ) ; glVertex3d ( -1.0,  1.0,  1.0 ) ; glVertex3d ( -1.61803398875,  0.61803398875, 0.0 ) ; glVertex3d ( -1.61803398875, -0.61803398875, 0.0 ) ; glVertex3d ( -1.0, -1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d (  0.850650808354,  0.0, -0.525731112119 ) ; glVertex3d (  0.61803398875,  0.0, -1.61803398875 ) ; glVertex3d (  1.0,  1.0, -1.0 ) ; glVertex3d (  1.61803398875,  0.61803398875, 0.0 ) ; glVertex3d (  1.61803398875, -0.61803398875, 0.0 ) ; glVertex3d (  1.0, -1.0, -1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d ( -0.850650808354,  0.0, -0.525731112119 ) ; glVertex3d ( -0.61803398875,  0.0, -1.61803398875 ) ; glVertex3d ( -1.0, -1.0, -1.0 ) ; glVertex3d ( -1.61803398875, -0.61803398875, 0.0 ) ; glVertex3d ( -1.61803398875,  0.61803398875, 0.0 ) ; glVertex3d ( -1.0,  1.0, -1.0 ) ;
-  glEnd () ;
-
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d (  0.525731112119,  0.850650808354,  0.0 ) ; glVertex3d (  1.61803398875,  0.61803398875,  0.0 ) ; glVertex3d (  1.0,  1.0, -1.0 ) ; glVertex3d ( 0.0,  1.61803398875, -0.61803398875 ) ; glVertex3d ( 0.0,  1.61803398875,  0.61803398875 ) ; glVertex3d (  1.0,  1.0,  1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d (  0.525731112119, -0.850650808354,  0.0 ) ; glVertex3d (  1.61803398875, -0.61803398875,  0.0 ) ; glVertex3d (  1.0, -1.0,  1.0 ) ; glVertex3d ( 0.0, -1.61803398875,  0.61803398875 ) ; glVertex3d ( 0.0, -1.61803398875, -0.61803398875 ) ; glVertex3d (  1.0, -1.0, -1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d ( -0.525731112119,  0.850650808354,  0.0 ) ; glVertex3d ( -1.61803398875,  0.61803398875,  0.0 ) ; glVertex3d ( -1.0,  1.0,  1.0 ) ; glVertex3d ( 0.0,  1.61803398875,  0.61803398875 ) ; glVertex3d ( 0.0,  1.61803398875, -0.61803398875 ) ; glVertex3d ( -1.0,  1.0, -1.0 ) ;
-  glEnd () ;
-  glBegin ( GL_POLYGON ) ;
-  glNormal3d ( -0.525731112119, -0.850650808354,  0.0 ) ; glVertex3d ( -1.61803398875, -0.61803398875,  0.0 ) ; glVertex3d ( -1.0, -1.0, -1.0 ) ; glVertex3d ( 0.0, -1.61803398875, -0.61803398875 ) ; glVertex3d ( 0.0, -1.61803398875,  0.61803398875 ) ; glVertex3d ( -1.0, -1.0,  1.0 ) ;
-  glEnd () ;
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_DODECAHEDRON, 12, 5, &dodec_r[0][0], &dodec_v[0][0], &dodec_n[0][0] ), GL_FALSE ) ;
 }
 
 /*
  *
  */
+static GLfloat octa_r[6][3] = {
+    {  1.0f,  0.0f,  0.0f },
+    {  0.0f,  1.0f,  0.0f },
+    {  0.0f,  0.0f,  1.0f },
+    { -1.0f,  0.0f,  0.0f },
+    {  0.0f, -1.0f,  0.0f },
+    {  0.0f,  0.0f, -1.0f }
+};
+
+static int octa_v [8][3] = {
+    { 0, 1, 2 },
+    { 0, 5, 1 },
+    { 0, 2, 4 },
+    { 0, 4, 5 },
+    { 3, 2, 1 },
+    { 3, 1, 5 },
+    { 3, 4, 2 },
+    { 3, 5, 4 }
+};
+
+static GLfloat octa_n[8][3] = {
+    {  0.577350269189f,  0.577350269189f,  0.577350269189f },
+    {  0.577350269189f,  0.577350269189f, -0.577350269189f },
+    {  0.577350269189f, -0.577350269189f,  0.577350269189f },
+    {  0.577350269189f, -0.577350269189f, -0.577350269189f },
+    { -0.577350269189f,  0.577350269189f,  0.577350269189f },
+    { -0.577350269189f,  0.577350269189f, -0.577350269189f },
+    { -0.577350269189f, -0.577350269189f,  0.577350269189f },
+    { -0.577350269189f, -0.577350269189f, -0.577350269189f }
+};
+
 void FGAPIENTRY glutWireOctahedron( void )
 {
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireOctahedron" );
 
-#define RADIUS    1.0f
-  glBegin( GL_LINE_LOOP );
-    glNormal3d( 0.577350269189, 0.577350269189, 0.577350269189); glVertex3d( RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, RADIUS, 0.0 ); glVertex3d( 0.0, 0.0, RADIUS );
-    glNormal3d( 0.577350269189, 0.577350269189,-0.577350269189); glVertex3d( RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, 0.0,-RADIUS ); glVertex3d( 0.0, RADIUS, 0.0 );
-    glNormal3d( 0.577350269189,-0.577350269189, 0.577350269189); glVertex3d( RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, 0.0, RADIUS ); glVertex3d( 0.0,-RADIUS, 0.0 );
-    glNormal3d( 0.577350269189,-0.577350269189,-0.577350269189); glVertex3d( RADIUS, 0.0, 0.0 ); glVertex3d( 0.0,-RADIUS, 0.0 ); glVertex3d( 0.0, 0.0,-RADIUS );
-    glNormal3d(-0.577350269189, 0.577350269189, 0.577350269189); glVertex3d(-RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, 0.0, RADIUS ); glVertex3d( 0.0, RADIUS, 0.0 );
-    glNormal3d(-0.577350269189, 0.577350269189,-0.577350269189); glVertex3d(-RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, RADIUS, 0.0 ); glVertex3d( 0.0, 0.0,-RADIUS );
-    glNormal3d(-0.577350269189,-0.577350269189, 0.577350269189); glVertex3d(-RADIUS, 0.0, 0.0 ); glVertex3d( 0.0,-RADIUS, 0.0 ); glVertex3d( 0.0, 0.0, RADIUS );
-    glNormal3d(-0.577350269189,-0.577350269189,-0.577350269189); glVertex3d(-RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, 0.0,-RADIUS ); glVertex3d( 0.0,-RADIUS, 0.0 );
-  glEnd();
-#undef RADIUS
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_OCTAHEDRON, 8, 3, &octa_r[0][0], &octa_v[0][0], &octa_n[0][0] ), GL_TRUE ) ;
 }
 
 /*
@@ -891,18 +1353,7 @@ void FGAPIENTRY glutSolidOctahedron( void )
 {
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidOctahedron" );
 
-#define RADIUS    1.0f
-  glBegin( GL_TRIANGLES );
-    glNormal3d( 0.577350269189, 0.577350269189, 0.577350269189); glVertex3d( RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, RADIUS, 0.0 ); glVertex3d( 0.0, 0.0, RADIUS );
-    glNormal3d( 0.577350269189, 0.577350269189,-0.577350269189); glVertex3d( RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, 0.0,-RADIUS ); glVertex3d( 0.0, RADIUS, 0.0 );
-    glNormal3d( 0.577350269189,-0.577350269189, 0.577350269189); glVertex3d( RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, 0.0, RADIUS ); glVertex3d( 0.0,-RADIUS, 0.0 );
-    glNormal3d( 0.577350269189,-0.577350269189,-0.577350269189); glVertex3d( RADIUS, 0.0, 0.0 ); glVertex3d( 0.0,-RADIUS, 0.0 ); glVertex3d( 0.0, 0.0,-RADIUS );
-    glNormal3d(-0.577350269189, 0.577350269189, 0.577350269189); glVertex3d(-RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, 0.0, RADIUS ); glVertex3d( 0.0, RADIUS, 0.0 );
-    glNormal3d(-0.577350269189, 0.577350269189,-0.577350269189); glVertex3d(-RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, RADIUS, 0.0 ); glVertex3d( 0.0, 0.0,-RADIUS );
-    glNormal3d(-0.577350269189,-0.577350269189, 0.577350269189); glVertex3d(-RADIUS, 0.0, 0.0 ); glVertex3d( 0.0,-RADIUS, 0.0 ); glVertex3d( 0.0, 0.0, RADIUS );
-    glNormal3d(-0.577350269189,-0.577350269189,-0.577350269189); glVertex3d(-RADIUS, 0.0, 0.0 ); glVertex3d( 0.0, 0.0,-RADIUS ); glVertex3d( 0.0,-RADIUS, 0.0 );
-  glEnd();
-#undef RADIUS
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_OCTAHEDRON, 8, 3, &octa_r[0][0], &octa_v[0][0], &octa_n[0][0] ), GL_FALSE ) ;
 }
 
 /* Magic Numbers:  r0 = ( 1, 0, 0 )
@@ -917,12 +1368,12 @@ void FGAPIENTRY glutSolidOctahedron( void )
 
 #define NUM_TETR_FACES     4
 
-static GLdouble tet_r[4][3] = { {             1.0,             0.0,             0.0 },
-                                { -0.333333333333,  0.942809041582,             0.0 },
-                                { -0.333333333333, -0.471404520791,  0.816496580928 },
-                                { -0.333333333333, -0.471404520791, -0.816496580928 } } ;
+static GLfloat tet_r[4][3] = { {             1.0f,             0.0f,             0.0f },
+                                { -0.333333333333f,  0.942809041582f,             0.0f },
+                                { -0.333333333333f, -0.471404520791f,  0.816496580928f },
+                                { -0.333333333333f, -0.471404520791f, -0.816496580928f } } ;
 
-static GLint tet_i[4][3] =  /* Vertex indices */
+static int tet_i[4][3] =  /* Vertex indices */
 {
   { 1, 3, 2 }, { 0, 2, 3 }, { 0, 3, 1 }, { 0, 1, 2 }
 } ;
@@ -934,12 +1385,7 @@ void FGAPIENTRY glutWireTetrahedron( void )
 {
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireTetrahedron" );
 
-  glBegin( GL_LINE_LOOP ) ;
-    glNormal3d ( -tet_r[0][0], -tet_r[0][1], -tet_r[0][2] ) ; glVertex3dv ( tet_r[1] ) ; glVertex3dv ( tet_r[3] ) ; glVertex3dv ( tet_r[2] ) ;
-    glNormal3d ( -tet_r[1][0], -tet_r[1][1], -tet_r[1][2] ) ; glVertex3dv ( tet_r[0] ) ; glVertex3dv ( tet_r[2] ) ; glVertex3dv ( tet_r[3] ) ;
-    glNormal3d ( -tet_r[2][0], -tet_r[2][1], -tet_r[2][2] ) ; glVertex3dv ( tet_r[0] ) ; glVertex3dv ( tet_r[3] ) ; glVertex3dv ( tet_r[1] ) ;
-    glNormal3d ( -tet_r[3][0], -tet_r[3][1], -tet_r[3][2] ) ; glVertex3dv ( tet_r[0] ) ; glVertex3dv ( tet_r[1] ) ; glVertex3dv ( tet_r[2] ) ;
-  glEnd() ;
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_TETRAHEDRON, 4, 3, &tet_r[0][0], &tet_i[0][0], NULL ), GL_TRUE ) ;
 }
 
 /*
@@ -949,30 +1395,25 @@ void FGAPIENTRY glutSolidTetrahedron( void )
 {
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidTetrahedron" );
 
-  glBegin( GL_TRIANGLES ) ;
-    glNormal3d ( -tet_r[0][0], -tet_r[0][1], -tet_r[0][2] ) ; glVertex3dv ( tet_r[1] ) ; glVertex3dv ( tet_r[3] ) ; glVertex3dv ( tet_r[2] ) ;
-    glNormal3d ( -tet_r[1][0], -tet_r[1][1], -tet_r[1][2] ) ; glVertex3dv ( tet_r[0] ) ; glVertex3dv ( tet_r[2] ) ; glVertex3dv ( tet_r[3] ) ;
-    glNormal3d ( -tet_r[2][0], -tet_r[2][1], -tet_r[2][2] ) ; glVertex3dv ( tet_r[0] ) ; glVertex3dv ( tet_r[3] ) ; glVertex3dv ( tet_r[1] ) ;
-    glNormal3d ( -tet_r[3][0], -tet_r[3][1], -tet_r[3][2] ) ; glVertex3dv ( tet_r[0] ) ; glVertex3dv ( tet_r[1] ) ; glVertex3dv ( tet_r[2] ) ;
-  glEnd() ;
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_TETRAHEDRON, 4, 3, &tet_r[0][0], &tet_i[0][0], NULL ), GL_FALSE ) ;
 }
 
 /*
  *
  */
-static double icos_r[12][3] = {
-    {  1.0,             0.0,             0.0            },
-    {  0.447213595500,  0.894427191000,  0.0            },
-    {  0.447213595500,  0.276393202252,  0.850650808354 },
-    {  0.447213595500, -0.723606797748,  0.525731112119 },
-    {  0.447213595500, -0.723606797748, -0.525731112119 },
-    {  0.447213595500,  0.276393202252, -0.850650808354 },
-    { -0.447213595500, -0.894427191000,  0.0 },
-    { -0.447213595500, -0.276393202252,  0.850650808354 },
-    { -0.447213595500,  0.723606797748,  0.525731112119 },
-    { -0.447213595500,  0.723606797748, -0.525731112119 },
-    { -0.447213595500, -0.276393202252, -0.850650808354 },
-    { -1.0,             0.0,             0.0            }
+static GLfloat icos_r[12][3] = {
+    {  1.0f,             0.0f,             0.0f            },
+    {  0.447213595500f,  0.894427191000f,  0.0f            },
+    {  0.447213595500f,  0.276393202252f,  0.850650808354f },
+    {  0.447213595500f, -0.723606797748f,  0.525731112119f },
+    {  0.447213595500f, -0.723606797748f, -0.525731112119f },
+    {  0.447213595500f,  0.276393202252f, -0.850650808354f },
+    { -0.447213595500f, -0.894427191000f,  0.0f },
+    { -0.447213595500f, -0.276393202252f,  0.850650808354f },
+    { -0.447213595500f,  0.723606797748f,  0.525731112119f },
+    { -0.447213595500f,  0.723606797748f, -0.525731112119f },
+    { -0.447213595500f, -0.276393202252f, -0.850650808354f },
+    { -1.0f,             0.0f,             0.0f            }
 };
 
 static int icos_v [20][3] = {
@@ -1000,23 +1441,9 @@ static int icos_v [20][3] = {
 
 void FGAPIENTRY glutWireIcosahedron( void )
 {
-  int i ;
-
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireIcosahedron" );
 
-  for ( i = 0; i < 20; i++ )
-  {
-    double normal[3] ;
-    normal[0] = ( icos_r[icos_v[i][1]][1] - icos_r[icos_v[i][0]][1] ) * ( icos_r[icos_v[i][2]][2] - icos_r[icos_v[i][0]][2] ) - ( icos_r[icos_v[i][1]][2] - icos_r[icos_v[i][0]][2] ) * ( icos_r[icos_v[i][2]][1] - icos_r[icos_v[i][0]][1] ) ;
-    normal[1] = ( icos_r[icos_v[i][1]][2] - icos_r[icos_v[i][0]][2] ) * ( icos_r[icos_v[i][2]][0] - icos_r[icos_v[i][0]][0] ) - ( icos_r[icos_v[i][1]][0] - icos_r[icos_v[i][0]][0] ) * ( icos_r[icos_v[i][2]][2] - icos_r[icos_v[i][0]][2] ) ;
-    normal[2] = ( icos_r[icos_v[i][1]][0] - icos_r[icos_v[i][0]][0] ) * ( icos_r[icos_v[i][2]][1] - icos_r[icos_v[i][0]][1] ) - ( icos_r[icos_v[i][1]][1] - icos_r[icos_v[i][0]][1] ) * ( icos_r[icos_v[i][2]][0] - icos_r[icos_v[i][0]][0] ) ;
-    glBegin ( GL_LINE_LOOP ) ;
-      glNormal3dv ( normal ) ;
-      glVertex3dv ( icos_r[icos_v[i][0]] ) ;
-      glVertex3dv ( icos_r[icos_v[i][1]] ) ;
-      glVertex3dv ( icos_r[icos_v[i][2]] ) ;
-    glEnd () ;
-  }
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_ICOSAHEDRON, 20, 3, &icos_r[0][0], &icos_v[0][0], NULL ), GL_TRUE ) ;
 }
 
 /*
@@ -1024,44 +1451,29 @@ void FGAPIENTRY glutWireIcosahedron( void )
  */
 void FGAPIENTRY glutSolidIcosahedron( void )
 {
-  int i ;
-
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidIcosahedron" );
 
-  glBegin ( GL_TRIANGLES ) ;
-  for ( i = 0; i < 20; i++ )
-  {
-    double normal[3] ;
-    normal[0] = ( icos_r[icos_v[i][1]][1] - icos_r[icos_v[i][0]][1] ) * ( icos_r[icos_v[i][2]][2] - icos_r[icos_v[i][0]][2] ) - ( icos_r[icos_v[i][1]][2] - icos_r[icos_v[i][0]][2] ) * ( icos_r[icos_v[i][2]][1] - icos_r[icos_v[i][0]][1] ) ;
-    normal[1] = ( icos_r[icos_v[i][1]][2] - icos_r[icos_v[i][0]][2] ) * ( icos_r[icos_v[i][2]][0] - icos_r[icos_v[i][0]][0] ) - ( icos_r[icos_v[i][1]][0] - icos_r[icos_v[i][0]][0] ) * ( icos_r[icos_v[i][2]][2] - icos_r[icos_v[i][0]][2] ) ;
-    normal[2] = ( icos_r[icos_v[i][1]][0] - icos_r[icos_v[i][0]][0] ) * ( icos_r[icos_v[i][2]][1] - icos_r[icos_v[i][0]][1] ) - ( icos_r[icos_v[i][1]][1] - icos_r[icos_v[i][0]][1] ) * ( icos_r[icos_v[i][2]][0] - icos_r[icos_v[i][0]][0] ) ;
-      glNormal3dv ( normal ) ;
-      glVertex3dv ( icos_r[icos_v[i][0]] ) ;
-      glVertex3dv ( icos_r[icos_v[i][1]] ) ;
-      glVertex3dv ( icos_r[icos_v[i][2]] ) ;
-  }
-
-  glEnd () ;
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_ICOSAHEDRON, 20, 3, &icos_r[0][0], &icos_v[0][0], NULL ), GL_FALSE ) ;
 }
 
 /*
  *
  */
-static double rdod_r[14][3] = {
-    {  0.0,             0.0,             1.0 },
-    {  0.707106781187,  0.000000000000,  0.5 },
-    {  0.000000000000,  0.707106781187,  0.5 },
-    { -0.707106781187,  0.000000000000,  0.5 },
-    {  0.000000000000, -0.707106781187,  0.5 },
-    {  0.707106781187,  0.707106781187,  0.0 },
-    { -0.707106781187,  0.707106781187,  0.0 },
-    { -0.707106781187, -0.707106781187,  0.0 },
-    {  0.707106781187, -0.707106781187,  0.0 },
-    {  0.707106781187,  0.000000000000, -0.5 },
-    {  0.000000000000,  0.707106781187, -0.5 },
-    { -0.707106781187,  0.000000000000, -0.5 },
-    {  0.000000000000, -0.707106781187, -0.5 },
-    {  0.0,             0.0,            -1.0 }
+static GLfloat rdod_r[14][3] = {
+    {  0.0f,             0.0f,             1.0f },
+    {  0.707106781187f,  0.000000000000f,  0.5f },
+    {  0.000000000000f,  0.707106781187f,  0.5f },
+    { -0.707106781187f,  0.000000000000f,  0.5f },
+    {  0.000000000000f, -0.707106781187f,  0.5f },
+    {  0.707106781187f,  0.707106781187f,  0.0f },
+    { -0.707106781187f,  0.707106781187f,  0.0f },
+    { -0.707106781187f, -0.707106781187f,  0.0f },
+    {  0.707106781187f, -0.707106781187f,  0.0f },
+    {  0.707106781187f,  0.000000000000f, -0.5f },
+    {  0.000000000000f,  0.707106781187f, -0.5f },
+    { -0.707106781187f,  0.000000000000f, -0.5f },
+    {  0.000000000000f, -0.707106781187f, -0.5f },
+    {  0.0f,             0.0f,            -1.0f }
 } ;
 
 static int rdod_v [12][4] = {
@@ -1079,37 +1491,26 @@ static int rdod_v [12][4] = {
     { 8, 12, 13,  9 }
 };
 
-static double rdod_n[12][3] = {
-    {  0.353553390594,  0.353553390594,  0.5 },
-    { -0.353553390594,  0.353553390594,  0.5 },
-    { -0.353553390594, -0.353553390594,  0.5 },
-    {  0.353553390594, -0.353553390594,  0.5 },
-    {  0.000000000000,  1.000000000000,  0.0 },
-    { -1.000000000000,  0.000000000000,  0.0 },
-    {  0.000000000000, -1.000000000000,  0.0 },
-    {  1.000000000000,  0.000000000000,  0.0 },
-    {  0.353553390594,  0.353553390594, -0.5 },
-    { -0.353553390594,  0.353553390594, -0.5 },
-    { -0.353553390594, -0.353553390594, -0.5 },
-    {  0.353553390594, -0.353553390594, -0.5 }
+static GLfloat rdod_n[12][3] = {
+    {  0.353553390594f,  0.353553390594f,  0.5f },
+    { -0.353553390594f,  0.353553390594f,  0.5f },
+    { -0.353553390594f, -0.353553390594f,  0.5f },
+    {  0.353553390594f, -0.353553390594f,  0.5f },
+    {  0.000000000000f,  1.000000000000f,  0.0f },
+    { -1.000000000000f,  0.000000000000f,  0.0f },
+    {  0.000000000000f, -1.000000000000f,  0.0f },
+    {  1.000000000000f,  0.000000000000f,  0.0f },
+    {  0.353553390594f,  0.353553390594f, -0.5f },
+    { -0.353553390594f,  0.353553390594f, -0.5f },
+    { -0.353553390594f, -0.353553390594f, -0.5f },
+    {  0.353553390594f, -0.353553390594f, -0.5f }
 };
 
 void FGAPIENTRY glutWireRhombicDodecahedron( void )
 {
-  int i ;
-
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireRhombicDodecahedron" );
 
-  for ( i = 0; i < 12; i++ )
-  {
-    glBegin ( GL_LINE_LOOP ) ;
-      glNormal3dv ( rdod_n[i] ) ;
-      glVertex3dv ( rdod_r[rdod_v[i][0]] ) ;
-      glVertex3dv ( rdod_r[rdod_v[i][1]] ) ;
-      glVertex3dv ( rdod_r[rdod_v[i][2]] ) ;
-      glVertex3dv ( rdod_r[rdod_v[i][3]] ) ;
-    glEnd () ;
-  }
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_RHOMBIC_DODECAHEDRON, 12, 4, &rdod_r[0][0], &rdod_v[0][0], &rdod_n[0][0] ), GL_TRUE ) ;
 }
 
 /*
@@ -1117,99 +1518,257 @@ void FGAPIENTRY glutWireRhombicDodecahedron( void )
  */
 void FGAPIENTRY glutSolidRhombicDodecahedron( void )
 {
-  int i ;
-
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidRhombicDodecahedron" );
 
-  glBegin ( GL_QUADS ) ;
-  for ( i = 0; i < 12; i++ )
-  {
-      glNormal3dv ( rdod_n[i] ) ;
-      glVertex3dv ( rdod_r[rdod_v[i][0]] ) ;
-      glVertex3dv ( rdod_r[rdod_v[i][1]] ) ;
-      glVertex3dv ( rdod_r[rdod_v[i][2]] ) ;
-      glVertex3dv ( rdod_r[rdod_v[i][3]] ) ;
-  }
-
-  glEnd () ;
+  fgDrawMesh( fghPolyhedronMesh( FG_MESH_RHOMBIC_DODECAHEDRON, 12, 4, &rdod_r[0][0], &rdod_v[0][0], &rdod_n[0][0] ), GL_FALSE ) ;
 }
 
-void FGAPIENTRY glutWireSierpinskiSponge ( int num_levels, GLdouble offset[3], GLdouble scale )
+/*
+ * The sponge is built once per level into a single vertex array, for a
+ * unit sponge at the origin; offset and scale are applied through the
+ * modelview matrix, so moving sponges around does not rebuild it.
+ * Deeper sponges draw the deepest cached one several times over, up to
+ * FGH_SPONGE_MAX_LEVELS, whose tetrahedra are 1/4096 of the sponge wide.
+ */
+#define  FGH_SPONGE_MAX_MESH_LEVELS  8
+#define  FGH_SPONGE_MAX_LEVELS      12
+
+static SFG_Mesh* fghSierpinskiSpongeMesh( int num_levels )
 {
-  int i, j ;
+    const GLdouble key = num_levels;
+    const int numTetr = 1 << ( 2 * num_levels );
+    GLdouble *centres, scale = 1.0;
+    int i, j, k, level;
+    SFG_Mesh* mesh = fgFindMesh( FG_MESH_SIERPINSKI_SPONGE, &key, 1 );
+
+    if( mesh )
+        return mesh;
+
+    mesh = fgCreateMesh( FG_MESH_SIERPINSKI_SPONGE, &key, 1,
+                         numTetr * NUM_TETR_FACES * 3, GL_FALSE );
+    mesh->NumLineIndices = numTetr * NUM_TETR_FACES * 6;
+    mesh->LineIndices = ( GLuint * )malloc( mesh->NumLineIndices * sizeof( GLuint ) );
+    centres = ( GLdouble * )malloc( numTetr * 3 * sizeof( GLdouble ) );
+
+    if( !mesh->LineIndices || !centres )
+        fgError( "Failed to allocate memory in fghSierpinskiSpongeMesh" );
+
+    /*
+     * Subdivide level by level. The children of tetrahedron i are stored
+     * at 4i..4i+3, which keeps the order the recursive version drew them
+     * in, and lets us work in place by walking the parents backwards.
+     */
+    centres[ 0 ] = centres[ 1 ] = centres[ 2 ] = 0.0;
+
+    for( level = 0; level < num_levels; level++ )
+    {
+        scale /= 2.0;
 
-  FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireSierpinskiSponge" );
+        for( i = ( 1 << ( 2 * level ) ) - 1; i >= 0; i-- )
+        {
+            const GLdouble x = centres[ 3 * i + 0 ];
+            const GLdouble y = centres[ 3 * i + 1 ];
+            const GLdouble z = centres[ 3 * i + 2 ];
+
+            for( k = 0; k < NUM_TETR_FACES; k++ )
+            {
+                centres[ 3 * ( 4 * i + k ) + 0 ] = x + scale * tet_r[ k ][ 0 ];
+                centres[ 3 * ( 4 * i + k ) + 1 ] = y + scale * tet_r[ k ][ 1 ];
+                centres[ 3 * ( 4 * i + k ) + 2 ] = z + scale * tet_r[ k ][ 2 ];
+            }
+        }
+    }
+
+    /* Emit the leaves, three vertices per face with a flat normal */
+    for( i = 0; i < numTetr; i++ )
+        for( k = 0; k < NUM_TETR_FACES; k++ )
+        {
+            const int face = 3 * ( i * NUM_TETR_FACES + k );
+            GLuint *line = mesh->LineIndices + 2 * face;
+
+            for( j = 0; j < 3; j++ )
+            {
+                GLfloat *v = mesh->Vertices + 3 * ( face + j );
+                GLfloat *n = mesh->Normals + 3 * ( face + j );
+
+                v[ 0 ] = ( GLfloat )( centres[ 3 * i + 0 ] + scale * tet_r[ tet_i[ k ][ j ] ][ 0 ] );
+                v[ 1 ] = ( GLfloat )( centres[ 3 * i + 1 ] + scale * tet_r[ tet_i[ k ][ j ] ][ 1 ] );
+                v[ 2 ] = ( GLfloat )( centres[ 3 * i + 2 ] + scale * tet_r[ tet_i[ k ][ j ] ][ 2 ] );
+                n[ 0 ] = ( GLfloat )-tet_r[ k ][ 0 ];
+                n[ 1 ] = ( GLfloat )-tet_r[ k ][ 1 ];
+                n[ 2 ] = ( GLfloat )-tet_r[ k ][ 2 ];
+
+                /* The wire sponge outlines each face as a closed loop */
+                line[ 2 * j + 0 ] = face + j;
+                line[ 2 * j + 1 ] = face + ( j + 1 ) % 3;
+            }
+        }
+
+    free( centres );
+
+    return mesh;
+}
+
+static void fghSierpinskiSponge ( int num_levels, GLdouble offset[3], GLdouble scale, GLboolean wire )
+{
+    SFG_Mesh* mesh;
+    int i, d, levels, extra, instances;
 
-  if ( num_levels == 0 )
-  {
+    if ( num_levels < 0 )
+        return;
 
-    for ( i = 0 ; i < NUM_TETR_FACES ; i++ )
+    if ( num_levels > FGH_SPONGE_MAX_LEVELS )
     {
-      glBegin ( GL_LINE_LOOP ) ;
-      glNormal3d ( -tet_r[i][0], -tet_r[i][1], -tet_r[i][2] ) ;
-      for ( j = 0; j < 3; j++ )
-      {
-        double x = offset[0] + scale * tet_r[tet_i[i][j]][0] ;
-        double y = offset[1] + scale * tet_r[tet_i[i][j]][1] ;
-        double z = offset[2] + scale * tet_r[tet_i[i][j]][2] ;
-        glVertex3d ( x, y, z ) ;
-      }
-
-      glEnd () ;
+        static GLboolean warned = GL_FALSE;
+
+        if ( !warned )
+            fgWarning ( "Sierpinski sponge of %d levels drawn with %d",
+                        num_levels, FGH_SPONGE_MAX_LEVELS );
+        warned = GL_TRUE;
+        num_levels = FGH_SPONGE_MAX_LEVELS;
     }
-  }
-  else if ( num_levels > 0 )
-  {
-    GLdouble local_offset[3] ;  /* Use a local variable to avoid buildup of roundoff errors */
-    num_levels -- ;
-    scale /= 2.0 ;
-    for ( i = 0 ; i < NUM_TETR_FACES ; i++ )
+
+    levels = ( num_levels > FGH_SPONGE_MAX_MESH_LEVELS ) ? FGH_SPONGE_MAX_MESH_LEVELS : num_levels;
+    extra = num_levels - levels;
+    instances = 1 << ( 2 * extra );
+    mesh = fghSierpinskiSpongeMesh( levels );
+
+    /* The mesh normals are unit length, glScaled() would change that */
+    glPushAttrib( GL_ENABLE_BIT );
+    glEnable( GL_NORMALIZE );
+
+    for ( i = 0 ; i < instances ; i++ )
     {
-      local_offset[0] = offset[0] + scale * tet_r[i][0] ;
-      local_offset[1] = offset[1] + scale * tet_r[i][1] ;
-      local_offset[2] = offset[2] + scale * tet_r[i][2] ;
-      glutWireSierpinskiSponge ( num_levels, local_offset, scale ) ;
+        GLdouble local_offset[3] ;
+        GLdouble local_scale = scale ;
+
+        local_offset[0] = offset[0] ;
+        local_offset[1] = offset[1] ;
+        local_offset[2] = offset[2] ;
+
+        /* Each pair of bits of i picks a child, topmost level first */
+        for ( d = extra - 1 ; d >= 0 ; d-- )
+        {
+            const int k = ( i >> ( 2 * d ) ) & 3 ;
+
+            local_scale /= 2.0 ;
+            local_offset[0] += local_scale * tet_r[k][0] ;
+            local_offset[1] += local_scale * tet_r[k][1] ;
+            local_offset[2] += local_scale * tet_r[k][2] ;
+        }
+
+        glPushMatrix( );
+        glTranslated( local_offset[0], local_offset[1], local_offset[2] );
+        glScaled( local_scale, local_scale, local_scale );
+        fgDrawMesh( mesh, wire );
+        glPopMatrix( );
     }
-  }
+
+    glPopAttrib( );
 }
 
-void FGAPIENTRY glutSolidSierpinskiSponge ( int num_levels, GLdouble offset[3], GLdouble scale )
+void FGAPIENTRY glutWireSierpinskiSponge ( int num_levels, GLdouble offset[3], GLdouble scale )
 {
-  int i, j ;
+  FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireSierpinskiSponge" );
+
+  fghSierpinskiSponge ( num_levels, offset, scale, GL_TRUE );
+}
 
+void FGAPIENTRY glutSolidSierpinskiSponge ( int num_levels, GLdouble offset[3], GLdouble scale )
+{
   FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidSierpinskiSponge" );
 
-  if ( num_levels == 0 )
-  {
-    glBegin ( GL_TRIANGLES ) ;
+  fghSierpinskiSponge ( num_levels, offset, scale, GL_FALSE );
+}
 
-    for ( i = 0 ; i < NUM_TETR_FACES ; i++ )
-    {
-      glNormal3d ( -tet_r[i][0], -tet_r[i][1], -tet_r[i][2] ) ;
-      for ( j = 0; j < 3; j++ )
-      {
-        double x = offset[0] + scale * tet_r[tet_i[i][j]][0] ;
-        double y = offset[1] + scale * tet_r[tet_i[i][j]][1] ;
-        double z = offset[2] + scale * tet_r[tet_i[i][j]][2] ;
-        glVertex3d ( x, y, z ) ;
-      }
-    }
+/*
+ * The "Auto" shapes pick their tessellation from the current matrices and
+ * viewport, so that no edge strays more than pixelError pixels from the
+ * true surface. Stacks only shade the straight sides of cones and
+ * cylinders, and get by with a quarter of the slices.
+ */
+void FGAPIENTRY glutWireSphereAuto( GLdouble radius, GLdouble pixelError )
+{
+    GLint slices;
 
-    glEnd () ;
-  }
-  else if ( num_levels > 0 )
-  {
-    GLdouble local_offset[3] ;  /* Use a local variable to avoid buildup of roundoff errors */
-    num_levels -- ;
-    scale /= 2.0 ;
-    for ( i = 0 ; i < NUM_TETR_FACES ; i++ )
-    {
-      local_offset[0] = offset[0] + scale * tet_r[i][0] ;
-      local_offset[1] = offset[1] + scale * tet_r[i][1] ;
-      local_offset[2] = offset[2] + scale * tet_r[i][2] ;
-      glutSolidSierpinskiSponge ( num_levels, local_offset, scale ) ;
-    }
-  }
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireSphereAuto" );
+
+    slices = fghAutoSlices( radius, radius, pixelError );
+    fghSphere( ( GLfloat )radius, slices, slices / 2, GL_TRUE );
+}
+
+void FGAPIENTRY glutSolidSphereAuto( GLdouble radius, GLdouble pixelError )
+{
+    GLint slices;
+
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidSphereAuto" );
+
+    slices = fghAutoSlices( radius, radius, pixelError );
+    fghSphere( ( GLfloat )radius, slices, slices / 2, GL_FALSE );
+}
+
+void FGAPIENTRY glutWireConeAuto( GLdouble base, GLdouble height, GLdouble pixelError )
+{
+    GLint slices;
+
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireConeAuto" );
+
+    slices = fghAutoSlices( base, sqrt( base * base + height * height ), pixelError );
+    fghCone( ( GLfloat )base, ( GLfloat )height, slices, slices / 4, GL_TRUE );
+}
+
+void FGAPIENTRY glutSolidConeAuto( GLdouble base, GLdouble height, GLdouble pixelError )
+{
+    GLint slices;
+
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidConeAuto" );
+
+    slices = fghAutoSlices( base, sqrt( base * base + height * height ), pixelError );
+    fghCone( ( GLfloat )base, ( GLfloat )height, slices, slices / 4, GL_FALSE );
+}
+
+void FGAPIENTRY glutWireCylinderAuto( GLdouble radius, GLdouble height, GLdouble pixelError )
+{
+    GLint slices;
+
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireCylinderAuto" );
+
+    slices = fghAutoSlices( radius, sqrt( radius * radius + height * height ), pixelError );
+    fghCylinder( ( GLfloat )radius, ( GLfloat )height, slices, slices / 4, GL_TRUE );
+}
+
+void FGAPIENTRY glutSolidCylinderAuto( GLdouble radius, GLdouble height, GLdouble pixelError )
+{
+    GLint slices;
+
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidCylinderAuto" );
+
+    slices = fghAutoSlices( radius, sqrt( radius * radius + height * height ), pixelError );
+    fghCylinder( ( GLfloat )radius, ( GLfloat )height, slices, slices / 4, GL_FALSE );
+}
+
+void FGAPIENTRY glutWireTorusAuto( GLdouble dInnerRadius, GLdouble dOuterRadius, GLdouble pixelError )
+{
+    const GLdouble bound = fabs( dInnerRadius ) + fabs( dOuterRadius );
+    GLint nSides, nRings;
+
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireTorusAuto" );
+
+    nSides = fghAutoSlices( dInnerRadius, bound, pixelError );
+    nRings = fghAutoSlices( bound, bound, pixelError );
+    fghTorus( ( GLfloat )dInnerRadius, ( GLfloat )dOuterRadius, nSides, nRings, GL_TRUE );
+}
+
+void FGAPIENTRY glutSolidTorusAuto( GLdouble dInnerRadius, GLdouble dOuterRadius, GLdouble pixelError )
+{
+    const GLdouble bound = fabs( dInnerRadius ) + fabs( dOuterRadius );
+    GLint nSides, nRings;
+
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidTorusAuto" );
+
+    nSides = fghAutoSlices( dInnerRadius, bound, pixelError );
+    nRings = fghAutoSlices( bound, bound, pixelError );
+    fghTorus( ( GLfloat )dInnerRadius, ( GLfloat )dOuterRadius, nSides, nRings, GL_FALSE );
 }
 
 /*** END OF FILE ***/
@@ -90,6 +90,9 @@ SFG_State fgState = { { -1, -1, GL_FALSE },  /* Position */
                       1,                      /* AuxiliaryBufferNumber */
                       4,                      /* SampleNumber */
                       GL_FALSE,               /* SkipStaleMotion */
+                      GL_FALSE,               /* BitmapFontAtlas */
+                      GL_TRUE,                /* StrokeFontPoints */
+                      0,                      /* MenuMaxRows */
                       1,                      /* MajorVersion */
                       0,                      /* MinorVersion */
                       0,                      /* ContextFlags */
@@ -435,6 +438,13 @@ void fgDeinitialize( void )
 
     fgDestroyStructure( );
 
+    fgDestroyMeshes( );
+    fgDestroyFontAtlases( );
+    fgDestroyStrokeArrays( );
+    fgDestroyCoreText( );
+    fgDestroyTexts( );
+    fgDestroyLoadedFonts( );
+
     while( ( timer = fgState.Timers.First) )
     {
         fgListRemove( &fgState.Timers, &timer->Node );
@@ -85,6 +85,7 @@
 /* -- FIXED CONFIGURATION LIMITS ------------------------------------------- */
 
 #define  FREEGLUT_MAX_MENUS         3
+#define  FREEGLUT_MAX_MESHES        64
 
 /* -- PLATFORM-SPECIFIC INCLUDES ------------------------------------------- */
 
@@ -346,6 +347,10 @@ struct tagSFG_State
 
     GLboolean        SkipStaleMotion;      /* skip stale motion events */
 
+    GLboolean        BitmapFontAtlas;      /* Draw bitmap strings from a texture */
+    GLboolean        StrokeFontPoints;     /* Dot stroke character vertices */
+    int              MenuMaxRows;          /* Menus scroll past this many rows */
+
     int              MajorVersion;         /* Major OpenGL context version  */
     int              MinorVersion;         /* Minor OpenGL context version  */
     int              ContextFlags;         /* OpenGL context flags          */
@@ -469,6 +474,7 @@ struct tagSFG_WindowState
 
     long            JoystickPollRate;   /* The joystick polling rate         */
     long            JoystickLastPoll;   /* When the last poll happened       */
+    unsigned long   JoystickSerial;     /* Joystick changes already reported */
 
     int             MouseX, MouseY;     /* The most recent mouse position    */
 
@@ -641,7 +647,9 @@ struct tagSFG_Menu
     SFG_Node            Node;
     void               *UserData;     /* User data passed back at callback   */
     int                 ID;           /* The global menu ID                  */
-    SFG_List            Entries;      /* The menu entries list               */
+    SFG_MenuEntry     **Entries;      /* The menu entries, in display order  */
+    int                 NumEntries;   /* How many entries the menu has       */
+    int                 EntriesSize;  /* Allocated length of Entries         */
     FGCBMenu            Callback;     /* The menu callback                   */
     FGCBDestroy         Destroy;      /* Destruction callback                */
     GLboolean           IsActive;     /* Is the menu selected?               */
@@ -652,20 +660,51 @@ struct tagSFG_Menu
     SFG_MenuEntry      *ActiveEntry;  /* Currently active entry in the menu  */
     SFG_Window         *Window;       /* Window for menu                     */
     SFG_Window         *ParentWindow; /* Window in which the menu is invoked */
+    SFG_Menu           *HashNext;     /* Next menu in the same ID bucket     */
+
+    GLuint              BodyList;     /* Menu box without highlight, compiled */
+    GLboolean           BodyChanged;  /* Entries changed since it was compiled*/
+    GLboolean           IsDrawn;      /* Window shows the last full redraw   */
+    int                 DrawnOrdinal; /* Row highlighted on screen, or -1    */
+    GLint               DrawBuffer;   /* Buffer to return to after a row     */
+
+    int                 NumRows;      /* Entry rows shown at once            */
+    int                 FirstRow;     /* Index of the top row shown          */
+    int                 ScrollArrow;  /* -1 or 1 when on a scroll arrow      */
+    SFG_MenuEntry     **SortedEntries;/* By label for type-ahead, or NULL    */
 };
 
 /* This is a menu entry */
 struct tagSFG_MenuEntry
 {
-    SFG_Node            Node;
     int                 ID;                     /* The menu entry ID (local) */
-    int                 Ordinal;                /* The menu's ordinal number */
+    int                 Ordinal;                /* Index in the menu's array */
     char*               Text;                   /* The text to be displayed  */
     SFG_Menu*           SubMenu;                /* Optional sub-menu tree    */
     GLboolean           IsActive;               /* Is the entry highlighted? */
     int                 Width;                  /* Label's width in pixels   */
 };
 
+/*
+ * What the core profile text renderer keeps in a context: the shader
+ * program and buffers that stand in for glBitmap() and vertex arrays,
+ * which core contexts lack, see freeglut_font.c
+ */
+typedef struct tagSFG_CoreText SFG_CoreText;
+struct tagSFG_CoreText
+{
+    int                 Profile;                /* 0 until the context is checked */
+    GLboolean           Failed;                 /* The program couldn't be made */
+    GLuint              Program;
+    GLint               TransformLocation;      /* To clip space, scale and offset */
+    GLint               ColorLocation;
+    GLint               TexturedLocation;
+    GLuint              VertexArray;
+    GLuint              Buffer;                 /* Streamed string vertices  */
+    GLuint              IndexBuffer;            /* Two triangles per quad    */
+    int                 NumIndexedQuads;
+};
+
 /*
  * A window, making part of freeglut windows hierarchy.
  * Should be kept portable.
@@ -717,6 +756,11 @@ struct tagSFG_Structure
 
     int              WindowID;       /* The new current window ID          */
     int              MenuID;         /* The new current menu ID            */
+
+    SFG_Menu**       MenuTable;      /* Menus hashed by ID, see fgMenuByID */
+    int              MenuTableSize;  /* Buckets in it, a power of two      */
+    int              NumMenus;       /* Menus in the table                 */
+    SFG_Menu*        ActiveMenu;     /* The one top-level menu shown now   */
 };
 
 /*
@@ -735,6 +779,8 @@ typedef void (* FGCBWindowEnumerator  )( SFG_Window *, SFG_Enumerator * );
 typedef void (* FGCBMenuEnumerator  )( SFG_Menu *, SFG_Enumerator * );
 
 /* The bitmap font structure */
+typedef struct tagSFG_FontFile SFG_FontFile;
+
 typedef struct tagSFG_Font SFG_Font;
 struct tagSFG_Font
 {
@@ -744,38 +790,194 @@ struct tagSFG_Font
     const GLubyte** Characters;   /* The characters mapping           */
 
     float           xorig, yorig; /* Relative origin of the character */
+
+    const GLubyte*  Data;         /* Or the characters packed together */
+    const unsigned short* Offsets;/* and where each of them starts    */
+    const GLubyte*  Advances;     /* Quantity advances, for measuring */
+
+    SFG_FontFile*   File;         /* Where missing characters load from */
 };
 
-/* The stroke font structures */
+/*
+ * The stroke font structure. The strips of character c are FirstStrip[ c ]
+ * to FirstStrip[ c + 1 ], each a line strip of Count[ s ] vertices from
+ * First[ s ], so a whole character or string is one glMultiDrawArrays()
+ */
+typedef struct tagSFG_StrokeFont SFG_StrokeFont;
+struct tagSFG_StrokeFont
+{
+    char*           Name;                       /* The source font name      */
+    int             Quantity;                   /* Number of chars in font   */
+    GLfloat         Height;                     /* Height of the characters  */
+    const GLfloat*  Right;                      /* Each character's advance  */
+    const int*      FirstStrip;                 /* Quantity + 1 strip indices*/
+    const GLint*    First;                      /* First vertex of each strip*/
+    const GLsizei*  Count;                      /* Vertex count of each strip*/
+    const GLfloat*  Vertices;                   /* 2 floats per vertex       */
+};
 
-typedef struct tagSFG_StrokeVertex SFG_StrokeVertex;
-struct tagSFG_StrokeVertex
+/*
+ * A bitmap font loaded by glutLoadBitmapFont() from an X11 BDF or PCF
+ * file. The file stays mapped into memory and each character is only
+ * converted to a glBitmap() ready glyph with its own size and origin when
+ * it is first used, see freeglut_font.c
+ */
+enum
 {
-    GLfloat         X, Y;
+    FG_FONT_FILE_BDF,
+    FG_FONT_FILE_PCF
 };
 
-typedef struct tagSFG_StrokeStrip SFG_StrokeStrip;
-struct tagSFG_StrokeStrip
+struct tagSFG_FontFile
 {
-    int             Number;
-    const SFG_StrokeVertex* Vertices;
+    int             Format;                     /* FG_FONT_FILE_BDF or _PCF   */
+    const GLubyte*  Data;                       /* The mapped file            */
+    size_t          Size;
+#if TARGET_HOST_MS_WINDOWS
+    HANDLE          Mapping;
+#endif
+    long**          Glyphs;                     /* BDF character offsets, in  */
+                                                /* pages of 256, -1 if absent */
+    long            DefaultGlyph;               /* Stands in for absent ones  */
+    const GLubyte***Pages;                      /* Characters past Quantity,  */
+                                                /* converted, in pages of 256 */
+    long            Metrics, Bitmaps, Encodings;/* PCF table offsets          */
+    int             MetricsFormat, BitmapsFormat, EncodingsFormat;
+    long            NumGlyphs;
+    GLubyte*        Advances;                   /* Built on first measuring   */
 };
 
-typedef struct tagSFG_StrokeChar SFG_StrokeChar;
-struct tagSFG_StrokeChar
+/*
+ * The fonts glutBitmapCharacter() and friends know about, built-in and
+ * loaded, see freeglut_font.c
+ */
+typedef struct tagSFG_FontEntry SFG_FontEntry;
+struct tagSFG_FontEntry
 {
-    GLfloat         Right;
-    int             Number;
-    const SFG_StrokeStrip* Strips;
+    void*           ID;                         /* The application's handle   */
+    SFG_Font*       Font;                       /* A bitmap font...           */
+    SFG_StrokeFont* StrokeFont;                 /* ...or a stroke font        */
 };
 
-typedef struct tagSFG_StrokeFont SFG_StrokeFont;
-struct tagSFG_StrokeFont
+/*
+ * A bitmap font expanded into an alpha texture, so that a whole string
+ * can be drawn as one batch of textured quads. Loaded fonts also get one
+ * per page of the characters past their first Quantity. The texel image
+ * is kept in client memory and uploaded once per context that uses it,
+ * see freeglut_font.c
+ */
+typedef struct tagSFG_FontAtlas SFG_FontAtlas;
+struct tagSFG_FontAtlas
 {
-    char*           Name;                       /* The source font name      */
-    int             Quantity;                   /* Number of chars in font   */
-    GLfloat         Height;                     /* Height of the characters  */
-    const SFG_StrokeChar** Characters;          /* The characters mapping    */
+    SFG_Node        Node;
+    const SFG_Font* Font;                       /* The font it was built from */
+    unsigned int    First;                      /* First character it holds   */
+    int             Count;                      /* Number of characters held  */
+    int             Width, Height;              /* Texture size, powers of 2  */
+    GLubyte*        Texels;                     /* Width * Height alpha bytes */
+    GLfloat*        TexCoords;                  /* s0, t0, s1, t1 per char    */
+    GLfloat*        Boxes;                      /* x0, y0, x1, y1 from origin */
+};
+
+typedef struct tagSFG_FontTexture SFG_FontTexture;
+struct tagSFG_FontTexture
+{
+    SFG_Node             Node;
+    const SFG_FontAtlas* Atlas;
+    GLuint               Texture;               /* Name in the context       */
+};
+
+/*
+ * The text state of an OpenGL context, shared by all the windows using
+ * that context, see freeglut_font.c
+ */
+typedef struct tagSFG_TextContext SFG_TextContext;
+struct tagSFG_TextContext
+{
+    SFG_Node              Node;
+    SFG_WindowContextType Context;
+    SFG_List              FontTextures;         /* Font atlases uploaded here */
+    SFG_CoreText          CoreText;             /* Text without glBitmap()   */
+};
+
+/*
+ * Stroke strips laid out for a string, to be drawn with a single
+ * glMultiDrawArrays() call, see freeglut_font.c
+ */
+typedef struct tagSFG_StrokeArrays SFG_StrokeArrays;
+struct tagSFG_StrokeArrays
+{
+    GLfloat*              Vertices;             /* 2 floats per vertex        */
+    GLint*                First;                /* First vertex of each strip */
+    GLsizei*              Count;                /* Vertex count of each strip */
+};
+
+/*
+ * A string laid out once by glutCreateText(), with its vertices kept
+ * ready for a single draw call, see freeglut_font.c
+ */
+typedef struct tagSFG_Text SFG_Text;
+struct tagSFG_Text
+{
+    int                   ID;                   /* Text object's ID number    */
+    void*                 FontID;               /* As the application gave it */
+    const SFG_Font*       Font;                 /* A bitmap font...           */
+    const SFG_StrokeFont* StrokeFont;           /* ...or a stroke font        */
+    const SFG_FontAtlas*  Atlas;                /* Bitmap font's atlas        */
+    unsigned char*        String;               /* Copy of the text           */
+    GLfloat               Advance[ 2 ];         /* Raster or pen step         */
+    GLfloat               Bounds[ 4 ];          /* Left, bottom, right, top   */
+    int                   NumQuads;             /* Atlas quads, bitmap fonts  */
+    int                   NumStrips;            /* Line strips, stroke fonts  */
+    GLfloat*              Vertices;
+    GLint*                First;                /* Per strip, stroke fonts    */
+    GLsizei*              Count;
+};
+
+/*
+ * A shape tessellated once into client-side vertex arrays, so it can
+ * be drawn with a single glDrawElements() call. Meshes are cached by
+ * shape type and build parameters, see freeglut_geometry.c
+ */
+enum
+{
+    FG_MESH_TEAPOT,
+    FG_MESH_SIERPINSKI_SPONGE,
+    FG_MESH_SPHERE,
+    FG_MESH_CONE,
+    FG_MESH_CYLINDER,
+    FG_MESH_TORUS,
+    FG_MESH_CUBE,
+    FG_MESH_TETRAHEDRON,
+    FG_MESH_OCTAHEDRON,
+    FG_MESH_DODECAHEDRON,
+    FG_MESH_ICOSAHEDRON,
+    FG_MESH_RHOMBIC_DODECAHEDRON,
+
+    /* Always make this the LAST one */
+    FG_MESH_TOTAL_TYPES
+};
+
+#define  FG_MESH_MAX_KEYS           6
+
+typedef struct tagSFG_Mesh SFG_Mesh;
+struct tagSFG_Mesh
+{
+    SFG_Node        Node;
+    int             Type;                  /* The FG_MESH_* shape type       */
+    int             NumKeys;               /* Number of build parameters...  */
+    GLdouble        Keys[ FG_MESH_MAX_KEYS ]; /* ...the mesh was built with  */
+
+    int             NumVertices;           /* Vertex count                   */
+    GLfloat*        Vertices;              /* 3 floats per vertex            */
+    GLfloat*        Normals;               /* 3 floats per vertex            */
+    GLfloat*        TexCoords;             /* 2 floats per vertex, or NULL   */
+    GLdouble        Sizes[ 2 ];            /* Torus radii Vertices are for   */
+
+    int             NumIndices;            /* Solid triangle list indices,   */
+    GLuint*         Indices;               /* NULL to draw the vertex array  */
+    int             NumLineIndices;        /* Wireframe line pair indices    */
+    GLuint*         LineIndices;
 };
 
 /* -- GLOBAL VARIABLES EXPORTS --------------------------------------------- */
@@ -897,6 +1099,14 @@ int         fgJoystickDetect( void );
 void        fgInitialiseJoysticks( void );
 void        fgJoystickClose( void );
 void        fgJoystickPollWindow( SFG_Window* window );
+int         fgJoystickEventsCoalesced( void );
+GLboolean   fgJoystickCanWait( void );
+void        fgJoystickSample( void );
+GLboolean   fgJoystickDispatchWindow( SFG_Window* window );
+GLboolean   fgJoystickHasNews( SFG_Window* window );
+#if TARGET_HOST_POSIX_X11
+int         fgJoystickAddWaitFDs( fd_set *fds );
+#endif
 
 /* InputDevice Initialisation and Closure */
 int         fgInputDeviceDetect( void );
@@ -979,6 +1189,9 @@ SFG_Menu* fgGetActiveMenu( );
  * of the menu user interface handling code...
  */
 void fgUpdateMenuHighlight ( SFG_Menu *menu );
+GLboolean fgScrollActiveMenu ( SFG_Window *window, int rows,
+                               int mouse_x, int mouse_y );
+void fgMenuKeyboard( SFG_Menu *menu, unsigned char key, int special );
 GLboolean fgCheckActiveMenu ( SFG_Window *window, int button, GLboolean pressed,
                               int mouse_x, int mouse_y );
 void fgDeactivateMenu( SFG_Window *window );
@@ -990,6 +1203,30 @@ void fgDeactivateMenu( SFG_Window *window );
  */
 void fgDisplayMenu( void );
 
+/*
+ * The shape mesh cache. Meshes are kept in most-recently-used order and
+ * the oldest one is dropped once FREEGLUT_MAX_MESHES are held. These
+ * functions are defined in freeglut_geometry.c file.
+ */
+SFG_Mesh* fgFindMesh( int type, const GLdouble* keys, int numKeys );
+SFG_Mesh* fgCreateMesh( int type, const GLdouble* keys, int numKeys,
+                        int numVertices, GLboolean texCoords );
+void      fgOptimizeMesh( SFG_Mesh* mesh );
+void      fgDrawMesh( const SFG_Mesh* mesh, GLboolean wire );
+void      fgDestroyMeshes( void );
+
+/*
+ * Bitmap font atlases and text state. The textures and buffers a context
+ * holds are deleted when the last window using it is destroyed. These
+ * functions are defined in freeglut_font.c file.
+ */
+void fgDestroyTextContext( SFG_Window* window );
+void fgDestroyFontAtlases( void );
+void fgDestroyStrokeArrays( void );
+void fgDestroyCoreText( void );
+void fgDestroyTexts( void );
+void fgDestroyLoadedFonts( void );
+
 /* Elapsed time as per glutGet(GLUT_ELAPSED_TIME). */
 long fgElapsedTime( void );
 
@@ -106,6 +106,15 @@
 #        if defined(JS_VERSION) && JS_VERSION >= 0x010000
 #            define JS_NEW
 #        endif
+
+/* the evdev interface, with hot-plug through inotify on /dev/input */
+#        if defined(JS_NEW) && defined(HAVE_LINUX_INPUT_H) && \
+            defined(HAVE_SYS_INOTIFY_H) && defined(HAVE_ERRNO_H)
+#            include <linux/input.h>
+#            include <sys/inotify.h>
+#            include <dirent.h>
+#            define JS_EVDEV
+#        endif
 #    else  /* Not BSD or Linux */
 #        ifndef JS_RETURN
 
@@ -410,13 +419,20 @@ struct tagSFG_Joystick
 #   endif
 
 #   ifdef JS_NEW
-       struct js_event     js;
+       int          events_coalesced;   /* By the last read that had any   */
        int          tmp_buttons;
        float        tmp_axes [ _JS_MAX_AXES ];
 #   else
        struct JS_DATA_TYPE js;
 #   endif
 
+#   ifdef JS_EVDEV
+       GLboolean     evdev;                            /* An event* device   */
+       GLboolean     evdev_dropped;                    /* Wait for SYN_REPORT */
+       signed char   evdev_axis   [ ABS_CNT ];            /* Code to axis    */
+       signed char   evdev_button [ KEY_CNT - BTN_MISC ]; /* Code to button  */
+#   endif
+
     char         fname [ 128 ];
     int          fd;
 #endif
@@ -432,6 +448,11 @@ struct tagSFG_Joystick
     float center   [ _JS_MAX_AXES ];
     float max      [ _JS_MAX_AXES ];
     float min      [ _JS_MAX_AXES ];
+
+    /* The last sample, shared by every window's callback */
+    int           snapshot_buttons;
+    float         snapshot_axes [ _JS_MAX_AXES ];
+    unsigned long serial;               /* fghJoystickSerial at last change */
 };
 
 /*
@@ -456,10 +477,448 @@ static void fghJoystickAddHatElement ( SFG_Joystick* joy, CFDictionaryRef hat );
 
 
 /*
- * The static joystick structure pointer
+ * The joystick structure pointers.  There are always MIN_NUM_JOYSTICKS of
+ * them; the evdev backend adds more as devices are plugged in.
+ */
+#define MIN_NUM_JOYSTICKS  2
+static SFG_Joystick **fgJoystick = NULL;
+static int fgNumJoysticks = 0;
+
+/*
+ * Bumped each time a sample changes a joystick, so windows can tell which
+ * joysticks have news for their callbacks
+ */
+static unsigned long fghJoystickSerial = 0;
+
+/*
+ * Make room for at least "count" joysticks
+ */
+static void fghJoystickReserve( int count )
+{
+    if( count > fgNumJoysticks )
+    {
+        fgJoystick = ( SFG_Joystick ** )realloc( fgJoystick,
+                                                 count * sizeof( SFG_Joystick * ) );
+        if( ! fgJoystick )
+            fgError( "Out of memory. Could not allocate joysticks." );
+
+        memset( fgJoystick + fgNumJoysticks, 0,
+                ( count - fgNumJoysticks ) * sizeof( SFG_Joystick * ) );
+        fgNumJoysticks = count;
+    }
+}
+
+#ifdef JS_EVDEV
+/*
+ * The Linux evdev backend.  Joystick-class devices are picked out of
+ * /dev/input/event* and inotify on /dev/input reports them coming and
+ * going, so a joystick can be plugged in after the program has started.
+ * The legacy /dev/input/js* code below is used only when no event device
+ * can be read but a js device can.
+ */
+static GLboolean fghJoystickUseEvdev = GL_FALSE;
+static int fghJoystickInotifyFD = -1;
+
+#define EVDEV_BITS_PER_LONG       ( 8 * sizeof( unsigned long ) )
+#define EVDEV_NLONGS( n )         ( ( (n) + EVDEV_BITS_PER_LONG - 1 ) / \
+                                    EVDEV_BITS_PER_LONG )
+#define EVDEV_TEST_BIT( bits, n ) ( ( (bits)[ (n) / EVDEV_BITS_PER_LONG ] >> \
+                                      ( (n) % EVDEV_BITS_PER_LONG ) ) & 1 )
+
+/*
+ * Joysticks and gamepads are the devices with an absolute axis and a
+ * button from the BTN_JOYSTICK or BTN_GAMEPAD ranges, which is roughly
+ * the test the kernel's joydev driver makes.
+ */
+static GLboolean fghJoystickEvdevIsJoystick( int fd )
+{
+    unsigned long absbits[ EVDEV_NLONGS( ABS_CNT ) ];
+    unsigned long keybits[ EVDEV_NLONGS( KEY_CNT ) ];
+    int code;
+
+    memset( absbits, 0, sizeof( absbits ) );
+    memset( keybits, 0, sizeof( keybits ) );
+
+    if( ioctl( fd, EVIOCGBIT( EV_ABS, sizeof( absbits ) ), absbits ) < 0 ||
+        ioctl( fd, EVIOCGBIT( EV_KEY, sizeof( keybits ) ), keybits ) < 0 )
+        return GL_FALSE;
+
+    for( code = 0; code < ABS_MISC; code++ )
+        if( EVDEV_TEST_BIT( absbits, code ) )
+            break;
+
+    if( code == ABS_MISC )
+        return GL_FALSE;
+
+    for( code = BTN_JOYSTICK; code < BTN_DIGI; code++ )
+        if( EVDEV_TEST_BIT( keybits, code ) )
+            return GL_TRUE;
+
+    return GL_FALSE;
+}
+
+/*
+ * Fetch the current button and axis state, after opening the device and
+ * after the kernel has dropped events
+ */
+static void fghJoystickEvdevSync( SFG_Joystick* joy )
+{
+    unsigned long keys[ EVDEV_NLONGS( KEY_CNT ) ];
+    struct input_absinfo abs;
+    int code;
+
+    memset( keys, 0, sizeof( keys ) );
+    ioctl( joy->fd, EVIOCGKEY( sizeof( keys ) ), keys );
+
+    joy->tmp_buttons = 0;
+    for( code = BTN_MISC; code < KEY_CNT; code++ )
+        if( joy->evdev_button[ code - BTN_MISC ] >= 0 &&
+            EVDEV_TEST_BIT( keys, code ) )
+            joy->tmp_buttons |= 1 << joy->evdev_button[ code - BTN_MISC ];
+
+    for( code = 0; code < ABS_CNT; code++ )
+        if( joy->evdev_axis[ code ] >= 0 &&
+            ioctl( joy->fd, EVIOCGABS( code ), &abs ) == 0 )
+            joy->tmp_axes[ joy->evdev_axis[ code ] ] = ( float )abs.value;
+}
+
+/*
+ * Number the axes and buttons of a freshly opened device the way joydev
+ * does, so the callback sees the same values through either interface
+ */
+static void fghJoystickEvdevOpen( SFG_Joystick* joy )
+{
+    unsigned long absbits[ EVDEV_NLONGS( ABS_CNT ) ];
+    unsigned long keybits[ EVDEV_NLONGS( KEY_CNT ) ];
+    struct input_absinfo abs;
+    int code, i;
+
+    memset( absbits, 0, sizeof( absbits ) );
+    memset( keybits, 0, sizeof( keybits ) );
+    ioctl( joy->fd, EVIOCGBIT( EV_ABS, sizeof( absbits ) ), absbits );
+    ioctl( joy->fd, EVIOCGBIT( EV_KEY, sizeof( keybits ) ), keybits );
+
+    memset( joy->evdev_axis, -1, sizeof( joy->evdev_axis ) );
+    memset( joy->evdev_button, -1, sizeof( joy->evdev_button ) );
+    joy->num_axes = joy->num_buttons = 0;
+    joy->evdev_dropped = GL_FALSE;
+
+    for( code = 0; code < ABS_CNT && joy->num_axes < _JS_MAX_AXES; code++ )
+    {
+        if( ! EVDEV_TEST_BIT( absbits, code ) ||
+            ioctl( joy->fd, EVIOCGABS( code ), &abs ) < 0 )
+            continue;
+
+        i = joy->num_axes++;
+        joy->evdev_axis[ code ] = i;
+
+        if( abs.maximum > abs.minimum )
+        {
+            joy->min   [ i ] = ( float )abs.minimum;
+            joy->max   [ i ] = ( float )abs.maximum;
+        }
+        else
+        {
+            joy->min   [ i ] = -1.0f;
+            joy->max   [ i ] =  1.0f;
+        }
+        joy->center   [ i ] = ( joy->min[ i ] + joy->max[ i ] ) / 2.0f;
+        joy->saturate [ i ] = 1.0f;
+
+        /*
+         * The driver's "flat" is the noise either side of centre, in raw
+         * units; the dead band is a fraction of the half range.
+         */
+        joy->dead_band[ i ] = 2.0f * abs.flat /
+                              ( joy->max[ i ] - joy->min[ i ] );
+        if( ( joy->dead_band[ i ] < 0.0f ) ||
+            ( joy->dead_band[ i ] >= 1.0f ) )
+            joy->dead_band[ i ] = 0.0f;
+    }
+
+    /* joydev puts the joystick and gamepad buttons first */
+    for( i = 0; i < KEY_CNT - BTN_MISC &&
+                joy->num_buttons < _JS_MAX_BUTTONS; i++ )
+    {
+        code = BTN_JOYSTICK + i;
+        if( code >= KEY_CNT )
+            code -= KEY_CNT - BTN_MISC;
+
+        if( EVDEV_TEST_BIT( keybits, code ) )
+            joy->evdev_button[ code - BTN_MISC ] = joy->num_buttons++;
+    }
+
+    if( ioctl( joy->fd, EVIOCGNAME( sizeof( joy->name ) - 1 ),
+               joy->name ) < 0 )
+        joy->name[ 0 ] = '\0';
+    joy->name[ sizeof( joy->name ) - 1 ] = '\0';
+
+    fghJoystickEvdevSync( joy );
+}
+
+/*
+ * Fold one input event into the cached state
+ */
+static void fghJoystickEvdevApply( SFG_Joystick* joy,
+                                   const struct input_event* ev )
+{
+    if( joy->evdev_dropped )
+    {
+        /* Everything up to the next report is incomplete, so refetch */
+        if( ev->type == EV_SYN && ev->code == SYN_REPORT )
+        {
+            joy->evdev_dropped = GL_FALSE;
+            fghJoystickEvdevSync( joy );
+        }
+        return;
+    }
+
+    switch( ev->type )
+    {
+    case EV_KEY:
+        if( ev->code >= BTN_MISC && ev->code < KEY_CNT &&
+            joy->evdev_button[ ev->code - BTN_MISC ] >= 0 )
+        {
+            int bit = 1 << joy->evdev_button[ ev->code - BTN_MISC ];
+
+            if( ev->value )
+                joy->tmp_buttons |= bit;
+            else
+                joy->tmp_buttons &= ~bit;
+        }
+        break;
+
+    case EV_ABS:
+        if( ev->code < ABS_CNT && joy->evdev_axis[ ev->code ] >= 0 )
+            joy->tmp_axes[ joy->evdev_axis[ ev->code ] ] = ( float )ev->value;
+        break;
+
+    case EV_SYN:
+        if( ev->code == SYN_DROPPED )
+            joy->evdev_dropped = GL_TRUE;
+        break;
+    }
+}
+
+/*
+ * Returns the joystick open on the given device node, or -1
+ */
+static int fghJoystickEvdevFind( const char *fname )
+{
+    int ident;
+
+    for( ident = 0; ident < fgNumJoysticks; ident++ )
+        if( fgJoystick[ ident ] && fgJoystick[ ident ]->fd >= 0 &&
+            strcmp( fgJoystick[ ident ]->fname, fname ) == 0 )
+            return ident;
+
+    return -1;
+}
+
+/*
+ * Creates an empty joystick slot, for a device to be plugged into later
+ */
+static void fghJoystickEvdevSlot( int ident )
+{
+    SFG_Joystick *joy;
+
+    fghJoystickReserve( ident + 1 );
+    if( fgJoystick[ ident ] )
+        return;
+
+    joy = ( SFG_Joystick * )calloc( sizeof( SFG_Joystick ), 1 );
+    joy->id = ident;
+    joy->fd = -1;
+    joy->evdev = GL_TRUE;
+    joy->error = GL_TRUE;
+    fgJoystick[ ident ] = joy;
+}
+
+/*
+ * Opens the device node if it is a joystick we do not have yet
+ */
+static void fghJoystickEvdevAdd( const char *fname )
+{
+    SFG_Joystick *joy;
+    int fd, ident;
+
+    if( fghJoystickEvdevFind( fname ) >= 0 )
+        return;
+
+    /*
+     * This fails while udev is still setting the permissions up; we try
+     * again when inotify reports the change of attributes.
+     */
+    fd = open( fname, O_RDONLY | O_NONBLOCK );
+    if( fd < 0 )
+        return;
+
+    if( ! fghJoystickEvdevIsJoystick( fd ) )
+    {
+        close( fd );
+        return;
+    }
+
+    /* Reuse the slot of an unplugged device, so the numbers stay small */
+    for( ident = 0; ident < fgNumJoysticks; ident++ )
+        if( ! fgJoystick[ ident ] || fgJoystick[ ident ]->fd < 0 )
+            break;
+
+    fghJoystickEvdevSlot( ident );
+    joy = fgJoystick[ ident ];
+
+    snprintf( joy->fname, sizeof( joy->fname ), "%s", fname );
+    joy->fd = fd;
+    joy->error = GL_FALSE;
+    fghJoystickEvdevOpen( joy );
+}
+
+/*
+ * Closes an unplugged device, leaving its slot empty
+ */
+static void fghJoystickEvdevRemove( SFG_Joystick* joy )
+{
+    if( joy->fd >= 0 )
+        close( joy->fd );
+
+    joy->fd = -1;
+    joy->error = GL_TRUE;
+    joy->num_axes = joy->num_buttons = 0;
+    joy->name[ 0 ] = '\0';
+}
+
+static int fghJoystickEvdevFilter( const struct dirent *entry )
+{
+    return strncmp( entry->d_name, "event", 5 ) == 0;
+}
+
+static int fghJoystickEvdevCompare( const struct dirent **a,
+                                    const struct dirent **b )
+{
+    return atoi( ( *a )->d_name + 5 ) - atoi( ( *b )->d_name + 5 );
+}
+
+/*
+ * Adds every joystick in /dev/input, in the order of the event numbers
+ */
+static void fghJoystickEvdevScan( void )
+{
+    struct dirent **entries;
+    char fname[ 128 ];
+    int i, n;
+
+    n = scandir( "/dev/input", &entries, fghJoystickEvdevFilter,
+                 fghJoystickEvdevCompare );
+
+    for( i = 0; i < n; i++ )
+    {
+        snprintf( fname, sizeof( fname ), "/dev/input/%.100s",
+                  entries[ i ]->d_name );
+        fghJoystickEvdevAdd( fname );
+        free( entries[ i ] );
+    }
+
+    if( n >= 0 )
+        free( entries );
+}
+
+/*
+ * Picks up devices plugged in or out since the last call
+ */
+static void fghJoystickEvdevHotplug( void )
+{
+    union
+    {
+        struct inotify_event event;
+        char buf[ 4096 ];
+    } u;
+    char fname[ 128 ];
+    int len, ident;
+    char *p;
+
+    if( fghJoystickInotifyFD < 0 )
+        return;
+
+    while( ( len = read( fghJoystickInotifyFD, u.buf, sizeof( u.buf ) ) ) > 0 )
+    {
+        for( p = u.buf; p < u.buf + len;
+             p += sizeof( struct inotify_event ) +
+                  ( ( struct inotify_event * )p )->len )
+        {
+            struct inotify_event *event = ( struct inotify_event * )p;
+
+            if( event->mask & IN_Q_OVERFLOW )
+                fghJoystickEvdevScan( );
+
+            if( event->len == 0 || strncmp( event->name, "event", 5 ) != 0 )
+                continue;
+
+            snprintf( fname, sizeof( fname ), "/dev/input/%.100s", event->name );
+
+            if( event->mask & IN_DELETE )
+            {
+                ident = fghJoystickEvdevFind( fname );
+                if( ident >= 0 )
+                    fghJoystickEvdevRemove( fgJoystick[ ident ] );
+            }
+            else
+                fghJoystickEvdevAdd( fname );
+        }
+    }
+}
+
+/*
+ * Starts watching /dev/input and opens the joysticks already there.
+ * Returns GL_FALSE, having opened nothing, when the legacy interface
+ * should be used instead.
  */
-#define MAX_NUM_JOYSTICKS  2
-static SFG_Joystick *fgJoystick [ MAX_NUM_JOYSTICKS ];
+static GLboolean fghJoystickEvdevInit( void )
+{
+    char fname[ 128 ];
+    int ident;
+
+    fghJoystickInotifyFD = inotify_init( );
+    if( fghJoystickInotifyFD >= 0 )
+    {
+        fcntl( fghJoystickInotifyFD, F_SETFL, O_NONBLOCK );
+        fcntl( fghJoystickInotifyFD, F_SETFD, FD_CLOEXEC );
+
+        if( inotify_add_watch( fghJoystickInotifyFD, "/dev/input",
+                               IN_CREATE | IN_ATTRIB | IN_DELETE ) < 0 )
+        {
+            close( fghJoystickInotifyFD );
+            fghJoystickInotifyFD = -1;
+        }
+    }
+
+    /* Watch first, so a device appearing during the scan is not missed */
+    fghJoystickEvdevScan( );
+
+    if( fgNumJoysticks == 0 )
+    {
+        /* Nothing readable here; fall back on js devices that are */
+        for( ident = 0; ident < MIN_NUM_JOYSTICKS; ident++ )
+        {
+            snprintf( fname, sizeof( fname ), "/dev/input/js%d", ident );
+            if( access( fname, R_OK ) != 0 )
+                snprintf( fname, sizeof( fname ), "/dev/js%d", ident );
+
+            if( access( fname, R_OK ) == 0 )
+            {
+                if( fghJoystickInotifyFD >= 0 )
+                    close( fghJoystickInotifyFD );
+                fghJoystickInotifyFD = -1;
+                return GL_FALSE;
+            }
+        }
+    }
+
+    for( ident = 0; ident < MIN_NUM_JOYSTICKS; ident++ )
+        fghJoystickEvdevSlot( ident );
+
+    return GL_TRUE;
+}
+#endif
 
 
 /*
@@ -477,6 +936,11 @@ static void fghJoystickRawRead( SFG_Joystick* joy, int* buttons, float* axes )
     int len;
 #endif
 
+#ifdef JS_NEW
+    struct js_event js_events[ 64 ];
+    int coalesced = 0;
+#endif
+
     int i;
 
     /* Defaults */
@@ -690,25 +1154,56 @@ static void fghJoystickRawRead( SFG_Joystick* joy, int* buttons, float* axes )
 #        endif
 #    endif
 
+#    ifdef JS_EVDEV
+    if( joy->evdev )
+    {
+        struct input_event events[ 64 ];
+
+        do
+        {
+            status = read( joy->fd, events, sizeof( events ) );
+
+            for( i = 0; i < status / ( int )sizeof( struct input_event ); i++ )
+                fghJoystickEvdevApply( joy, &events[ i ] );
+
+            coalesced += i;
+        }
+        while( status == sizeof( events ) );
+
+        if( coalesced )
+            joy->events_coalesced = coalesced;
+
+        if( status < 0 && errno != EAGAIN )
+        {
+            /* ENODEV: it has been unplugged */
+            fghJoystickEvdevRemove( joy );
+            return;
+        }
+
+        if( buttons )
+            *buttons = joy->tmp_buttons;
+        if( axes )
+            memcpy( axes, joy->tmp_axes, sizeof( float ) * joy->num_axes );
+        return;
+    }
+#    endif
+
 #    ifdef JS_NEW
 
-    while ( 1 )
+    /*
+     * Drain everything queued since the last poll, a batch per syscall,
+     * folding it into the cached state; a short read means we are done.
+     * Reads that find nothing leave the count of the last one that did.
+     */
+    do
     {
-        status = read ( joy->fd, &joy->js, sizeof(struct js_event) );
+        status = read( joy->fd, js_events, sizeof( js_events ) );
 
-        if ( status != sizeof( struct js_event ) )
+        if( status < 0 )
         {
 #ifdef HAVE_ERRNO_H
-            if ( errno == EAGAIN )
-            {
-                /* Use the old values */
-                if ( buttons )
-                    *buttons = joy->tmp_buttons;
-                if ( axes )
-                    memcpy( axes, joy->tmp_axes,
-                            sizeof( float ) * joy->num_axes );
-                return;
-            }
+            if( errno == EAGAIN )
+                break;
 #endif
 
             fgWarning ( "%s", joy->fname );
@@ -716,40 +1211,40 @@ static void fghJoystickRawRead( SFG_Joystick* joy, int* buttons, float* axes )
             return;
         }
 
-        switch ( joy->js.type & ~JS_EVENT_INIT )
+        for( i = 0; i < status / ( int )sizeof( struct js_event ); i++ )
         {
-        case JS_EVENT_BUTTON:
-            if( joy->js.value == 0 ) /* clear the flag */
-                joy->tmp_buttons &= ~( 1 << joy->js.number );
-            else
-                joy->tmp_buttons |= ( 1 << joy->js.number );
-            break;
-
-        case JS_EVENT_AXIS:
-            if ( joy->js.number < joy->num_axes )
+            switch( js_events[ i ].type & ~JS_EVENT_INIT )
             {
-                joy->tmp_axes[ joy->js.number ] = ( float )joy->js.value;
-
-                if( axes )
-                    memcpy( axes, joy->tmp_axes, sizeof(float) * joy->num_axes );
+            case JS_EVENT_BUTTON:
+                if( js_events[ i ].value == 0 ) /* clear the flag */
+                    joy->tmp_buttons &= ~( 1 << js_events[ i ].number );
+                else
+                    joy->tmp_buttons |= ( 1 << js_events[ i ].number );
+                break;
+
+            case JS_EVENT_AXIS:
+                if( js_events[ i ].number < joy->num_axes )
+                    joy->tmp_axes[ js_events[ i ].number ] =
+                        ( float )js_events[ i ].value;
+                break;
+
+            default:
+                fgWarning ( "PLIB_JS: Unrecognised /dev/js return!?!" );
+                break;
             }
-            break;
-
-        default:
-            fgWarning ( "PLIB_JS: Unrecognised /dev/js return!?!" );
-
-            /* use the old values */
-
-            if ( buttons != NULL ) *buttons = joy->tmp_buttons;
-            if ( axes    != NULL )
-                memcpy ( axes, joy->tmp_axes, sizeof(float) * joy->num_axes );
-
-            return;
         }
 
-        if( buttons )
-            *buttons = joy->tmp_buttons;
+        coalesced += i;
     }
+    while( status == sizeof( js_events ) );
+
+    if( coalesced )
+        joy->events_coalesced = coalesced;
+
+    if( buttons )
+        *buttons = joy->tmp_buttons;
+    if( axes )
+        memcpy( axes, joy->tmp_axes, sizeof( float ) * joy->num_axes );
 #    else
 
     status = read( joy->fd, &joy->js, JS_RETURN );
@@ -1493,8 +1988,7 @@ static void fghJoystickOpen( SFG_Joystick* joy )
  */
 static void fghJoystickInit( int ident )
 {
-    if( ident >= MAX_NUM_JOYSTICKS )
-      fgError( "Too large a joystick number: %d", ident );
+    fghJoystickReserve( ident + 1 );
 
     if( fgJoystick[ ident ] )
         fgError( "illegal attempt to initialize joystick device again" );
@@ -1602,14 +2096,19 @@ static void fghJoystickInit( int ident )
 }
 
 /*
- * Try initializing all the joysticks (well, both of them)
+ * Try initializing all the joysticks
  */
 void fgInitialiseJoysticks ( void )
 {
     if( !fgState.JoysticksInitialised )
     {
         int ident ;
-        for ( ident = 0; ident < MAX_NUM_JOYSTICKS; ident++ )
+
+#ifdef JS_EVDEV
+        fghJoystickUseEvdev = fghJoystickEvdevInit( );
+        if( ! fghJoystickUseEvdev )
+#endif
+        for ( ident = 0; ident < MIN_NUM_JOYSTICKS; ident++ )
             fghJoystickInit( ident );
 
         fgState.JoysticksInitialised = GL_TRUE;
@@ -1622,7 +2121,7 @@ void fgInitialiseJoysticks ( void )
 void fgJoystickClose( void )
 {
     int ident ;
-    for( ident = 0; ident < MAX_NUM_JOYSTICKS; ident++ )
+    for( ident = 0; ident < fgNumJoysticks; ident++ )
     {
         if( fgJoystick[ ident ] )
         {
@@ -1667,36 +2166,180 @@ void fgJoystickClose( void )
             /* show joystick has been deinitialized */
         }
     }
+
+    free( fgJoystick );
+    fgJoystick = NULL;
+    fgNumJoysticks = 0;
+
+#ifdef JS_EVDEV
+    if( fghJoystickInotifyFD >= 0 )
+        close( fghJoystickInotifyFD );
+    fghJoystickInotifyFD = -1;
+    fghJoystickUseEvdev = GL_FALSE;
+#endif
 }
 
 /*
- * Polls the joystick and executes the joystick callback hooked to the
- * window specified in the function's parameter:
+ * Reads every joystick once into its snapshot, which the windows'
+ * callbacks are then all given; called once per pass of the main loop
  */
-void fgJoystickPollWindow( SFG_Window* window )
+void fgJoystickSample( void )
 {
     float axes[ _JS_MAX_AXES ];
     int buttons;
     int ident;
 
+#ifdef JS_EVDEV
+    fghJoystickEvdevHotplug( );
+#endif
+
+    for( ident = 0; ident < fgNumJoysticks; ident++ )
+    {
+        SFG_Joystick *joy = fgJoystick[ ident ];
+
+        if( !joy || joy->error )
+            continue;
+
+        memset( axes, 0, sizeof( axes ) );
+        fghJoystickRead( joy, &buttons, axes );
+
+        if( !joy->error &&
+            ( buttons != joy->snapshot_buttons ||
+              memcmp( axes, joy->snapshot_axes, sizeof( axes ) ) != 0 ) )
+        {
+            joy->snapshot_buttons = buttons;
+            memcpy( joy->snapshot_axes, axes, sizeof( axes ) );
+            joy->serial = ++fghJoystickSerial;
+        }
+    }
+}
+
+/*
+ * Hands one joystick's snapshot to the window's callback
+ */
+static void fghJoystickInvoke( SFG_Window* window, SFG_Joystick* joy )
+{
+    INVOKE_WCB( *window, Joystick,
+                ( joy->snapshot_buttons,
+                  (int) ( joy->snapshot_axes[ 0 ] * 1000.0f ),
+                  (int) ( joy->snapshot_axes[ 1 ] * 1000.0f ),
+                  (int) ( joy->snapshot_axes[ 2 ] * 1000.0f ) )
+    );
+}
+
+/*
+ * Executes the joystick callback hooked to the window specified in the
+ * function's parameter with the latest sample of every joystick
+ */
+void fgJoystickPollWindow( SFG_Window* window )
+{
+    int ident;
+
     freeglut_return_if_fail( window );
     freeglut_return_if_fail( FETCH_WCB( *window, Joystick ) );
 
-    for( ident = 0; ident < MAX_NUM_JOYSTICKS; ident++ )
-    {
-        if( fgJoystick[ident] )
+    window->State.JoystickSerial = fghJoystickSerial;
+
+    for( ident = 0; ident < fgNumJoysticks; ident++ )
+        if( fgJoystick[ ident ] && !fgJoystick[ ident ]->error )
+            fghJoystickInvoke( window, fgJoystick[ ident ] );
+}
+
+/*
+ * Executes the window's joystick callback for each joystick that changed
+ * since the window last heard from it.  Returns GL_FALSE if none had.
+ */
+GLboolean fgJoystickDispatchWindow( SFG_Window* window )
+{
+    GLboolean dispatched = GL_FALSE;
+    unsigned long seen = window->State.JoystickSerial;
+    int ident;
+
+    window->State.JoystickSerial = fghJoystickSerial;
+
+    for( ident = 0; ident < fgNumJoysticks; ident++ )
+        if( fgJoystick[ ident ] && !fgJoystick[ ident ]->error &&
+            fgJoystick[ ident ]->serial > seen )
+        {
+            fghJoystickInvoke( window, fgJoystick[ ident ] );
+            dispatched = GL_TRUE;
+        }
+
+    return dispatched;
+}
+
+/*
+ * Whether some joystick changed since the window's callback last heard
+ */
+GLboolean fgJoystickHasNews( SFG_Window* window )
+{
+    return fghJoystickSerial > window->State.JoystickSerial;
+}
+
+/*
+ * Whether the main loop can wait on the joystick devices themselves,
+ * rather than waking up every so often to poll them
+ */
+GLboolean fgJoystickCanWait( void )
+{
+#ifdef JS_NEW
+    return fgState.JoysticksInitialised;
+#else
+    return GL_FALSE;
+#endif
+}
+
+#if TARGET_HOST_POSIX_X11
+/*
+ * Adds the open joystick devices, and the hot-plug watch, to the set the
+ * main loop waits on.  Returns the highest descriptor added, or -1.
+ */
+int fgJoystickAddWaitFDs( fd_set *fds )
+{
+    int maxfd = -1;
+#ifdef JS_NEW
+    int ident;
+
+    for( ident = 0; ident < fgNumJoysticks; ident++ )
+        if( fgJoystick[ ident ] && !fgJoystick[ ident ]->error &&
+            fgJoystick[ ident ]->fd >= 0 )
         {
-            fghJoystickRead( fgJoystick[ident], &buttons, axes );
-
-            if( !fgJoystick[ident]->error )
-                INVOKE_WCB( *window, Joystick,
-                            ( buttons,
-                              (int) ( axes[ 0 ] * 1000.0f ),
-                              (int) ( axes[ 1 ] * 1000.0f ),
-                              (int) ( axes[ 2 ] * 1000.0f ) )
-                );
+            FD_SET( fgJoystick[ ident ]->fd, fds );
+            if( fgJoystick[ ident ]->fd > maxfd )
+                maxfd = fgJoystick[ ident ]->fd;
         }
+
+#    ifdef JS_EVDEV
+    if( fghJoystickInotifyFD >= 0 )
+    {
+        FD_SET( fghJoystickInotifyFD, fds );
+        if( fghJoystickInotifyFD > maxfd )
+            maxfd = fghJoystickInotifyFD;
     }
+#    endif
+#endif
+
+    return maxfd;
+}
+#endif
+
+/*
+ * Implementation for glutDeviceGet(GLUT_JOYSTICK_EVENTS_COALESCED): how
+ * many device events each joystick's last read that found any folded
+ * into one sample, summed over the joysticks
+ */
+int fgJoystickEventsCoalesced( void )
+{
+    int total = 0;
+#ifdef JS_NEW
+    int ident;
+
+    for( ident = 0; ident < fgNumJoysticks; ident++ )
+        if( fgJoystick[ ident ] && !fgJoystick[ ident ]->error )
+            total += fgJoystick[ ident ]->events_coalesced;
+#endif
+
+    return total;
 }
 
 /*
@@ -1711,7 +2354,11 @@ int fgJoystickDetect( void )
     if ( !fgState.JoysticksInitialised )
         return 0;
 
-    for( ident=0; ident<MAX_NUM_JOYSTICKS; ident++ )
+#ifdef JS_EVDEV
+    fghJoystickEvdevHotplug( );
+#endif
+
+    for( ident=0; ident<fgNumJoysticks; ident++ )
         if( fgJoystick[ident] && !fgJoystick[ident]->error )
             return 1;
 
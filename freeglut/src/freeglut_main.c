@@ -283,9 +283,33 @@ static void fghcbCheckJoystickPolls( SFG_Window *window,
         checkTime )
     {
 #if !defined(_WIN32_WCE)
-        fgJoystickPollWindow( window );
-#endif /* !defined(_WIN32_WCE) */
+        GLboolean *sampled = ( GLboolean * )enumerator->data;
+
+        /*
+         * When the main loop waits on the devices the callback hears only
+         * of changes, and the poll rate just limits how often.
+         */
+        if( fgJoystickCanWait( ) )
+        {
+            if( FETCH_WCB( *window, Joystick ) &&
+                fgJoystickDispatchWindow( window ) )
+                window->State.JoystickLastPoll = checkTime;
+        }
+        else
+        {
+            /* The first window due this pass samples for all of them */
+            if( FETCH_WCB( *window, Joystick ) && ! *sampled )
+            {
+                fgJoystickSample( );
+                *sampled = GL_TRUE;
+            }
+
+            fgJoystickPollWindow( window );
+            window->State.JoystickLastPoll = checkTime;
+        }
+#else
         window->State.JoystickLastPoll = checkTime;
+#endif /* !defined(_WIN32_WCE) */
     }
 
     fgEnumSubWindows( window, fghcbCheckJoystickPolls, enumerator );
@@ -297,9 +321,19 @@ static void fghcbCheckJoystickPolls( SFG_Window *window,
 static void fghCheckJoystickPolls( void )
 {
     SFG_Enumerator enumerator;
+    GLboolean sampled = GL_FALSE;
 
     enumerator.found = GL_FALSE;
-    enumerator.data  =  NULL;
+    enumerator.data  = &sampled;
+
+#if !defined(_WIN32_WCE)
+    /* Devices we wait on must be drained on every pass */
+    if( fgJoystickCanWait( ) )
+    {
+        fgJoystickSample( );
+        sampled = GL_TRUE;
+    }
+#endif /* !defined(_WIN32_WCE) */
 
     fgEnumWindows( fghcbCheckJoystickPolls, &enumerator );
 }
@@ -452,6 +486,31 @@ static int fghHaveJoystick( void )
     fgEnumWindows( fghCheckJoystickCallback, &enumerator );
     return !!enumerator.data;
 }
+/*
+ * Lowers "msec" to the time left before some window may be told of
+ * joystick changes that its poll rate is holding back
+ */
+static void fghcbNextJoystickPoll( SFG_Window* w, SFG_Enumerator* e )
+{
+    if( FETCH_WCB( *w, Joystick ) && fgJoystickHasNews( w ) )
+    {
+        long *msec = ( long * )e->data;
+        long left = w->State.JoystickLastPoll + w->State.JoystickPollRate -
+                    fgElapsedTime( );
+
+        if( left < *msec )
+            *msec = ( left < 0 ) ? 0 : left;
+    }
+    fgEnumSubWindows( w, fghcbNextJoystickPoll, e );
+}
+static void fghNextJoystickPoll( long *msec )
+{
+    SFG_Enumerator enumerator;
+
+    enumerator.found = GL_FALSE;
+    enumerator.data = msec;
+    fgEnumWindows( fghcbNextJoystickPoll, &enumerator );
+}
 static void fghHavePendingRedisplaysCallback( SFG_Window* w, SFG_Enumerator* e)
 {
     if( w->State.Redisplay && w->State.Visible )
@@ -492,15 +551,26 @@ static long fghNextTimer( void )
 static void fghSleepForEvents( void )
 {
     long msec;
+    int haveJoystick;
 
     if( fgState.IdleCallback || fghHavePendingRedisplays( ) )
         return;
 
     msec = fghNextTimer( );
-    /* XXX Use GLUT timers for joysticks... */
-    /* XXX Dumb; forces granularity to .01sec */
-    if( fghHaveJoystick( ) && ( msec > 10 ) )     
-        msec = 10;
+    haveJoystick = fghHaveJoystick( );
+    if( haveJoystick )
+    {
+        /*
+         * Joysticks that we can wait on wake us up themselves; we need
+         * only come back for changes that a poll rate is holding back.
+         */
+        if( fgJoystickCanWait( ) )
+            fghNextJoystickPoll( &msec );
+        /* XXX Use GLUT timers for joysticks... */
+        /* XXX Dumb; forces granularity to .01sec */
+        else if( msec > 10 )
+            msec = 10;
+    }
 
 #if TARGET_HOST_POSIX_X11
     /*
@@ -516,15 +586,25 @@ static void fghSleepForEvents( void )
     {
         fd_set fdset;
         int err;
-        int socket;
+        int socket, maxfd;
         struct timeval wait;
 
         socket = ConnectionNumber( fgDisplay.Display );
         FD_ZERO( &fdset );
         FD_SET( socket, &fdset );
+        maxfd = socket;
+
+        if( haveJoystick && fgJoystickCanWait( ) )
+        {
+            int joystickfd = fgJoystickAddWaitFDs( &fdset );
+
+            if( joystickfd > maxfd )
+                maxfd = joystickfd;
+        }
+
         wait.tv_sec = msec / 1000;
         wait.tv_usec = (msec % 1000) * 1000;
-        err = select( socket+1, &fdset, NULL, NULL, &wait );
+        err = select( maxfd+1, &fdset, NULL, NULL, &wait );
 
 #ifdef HAVE_ERRNO_H
         if( ( -1 == err ) && ( errno != EINTR ) )
@@ -1124,6 +1204,8 @@ void FGAPIENTRY glutMainLoopEvent( void )
             {
                 GETWINDOW( xexpose );
                 window->State.Redisplay = GL_TRUE;
+                if( window->IsMenu && window->ActiveMenu )
+                    window->ActiveMenu->IsDrawn = GL_FALSE;
             }
             break;
 
@@ -1265,6 +1347,19 @@ void FGAPIENTRY glutMainLoopEvent( void )
              */
             button = event.xbutton.button - 1;
 
+            /*
+             * With a menu open, the wheel (buttons 3 and 4) scrolls it
+             * when it is too long to show at once.
+             */
+            if( window->ActiveMenu && ( ( button == 3 ) || ( button == 4 ) ) )
+            {
+                if( pressed )
+                    fgScrollActiveMenu( window, ( button == 3 ) ? -1 : 1,
+                                        event.xbutton.x_root,
+                                        event.xbutton.y_root );
+                break;
+            }
+
             /*
              * Do not execute the application's mouse callback if a menu
              * is hooked to this button.  In that case an appropriate
@@ -1366,6 +1461,48 @@ void FGAPIENTRY glutMainLoopEvent( void )
                 break;
             }
 
+            /* An open menu takes the keyboard, see fgMenuKeyboard() */
+            if( window->ActiveMenu )
+            {
+                if( event.type == KeyPress )
+                {
+                    XComposeStatus composeStatus;
+                    char asciiCode[ 32 ];
+                    KeySym keySym;
+                    int special = -1;
+
+                    if( XLookupString( &event.xkey, asciiCode, sizeof(asciiCode),
+                                       &keySym, &composeStatus ) > 0 )
+                        fgMenuKeyboard( window->ActiveMenu, asciiCode[ 0 ], -1 );
+                    else
+                    {
+                        switch( keySym )
+                        {
+                        case XK_KP_Left:
+                        case XK_Left:   special = GLUT_KEY_LEFT;      break;
+                        case XK_KP_Right:
+                        case XK_Right:  special = GLUT_KEY_RIGHT;     break;
+                        case XK_KP_Up:
+                        case XK_Up:     special = GLUT_KEY_UP;        break;
+                        case XK_KP_Down:
+                        case XK_Down:   special = GLUT_KEY_DOWN;      break;
+                        case XK_KP_Prior:
+                        case XK_Prior:  special = GLUT_KEY_PAGE_UP;   break;
+                        case XK_KP_Next:
+                        case XK_Next:   special = GLUT_KEY_PAGE_DOWN; break;
+                        case XK_KP_Home:
+                        case XK_Home:   special = GLUT_KEY_HOME;      break;
+                        case XK_KP_End:
+                        case XK_End:    special = GLUT_KEY_END;       break;
+                        }
+
+                        if( special != -1 )
+                            fgMenuKeyboard( window->ActiveMenu, 0, special );
+                    }
+                }
+                break;
+            }
+
             if( event.type == KeyPress )
             {
                 keyboard_cb = (FGCBKeyboard)( FETCH_WCB( *window, Keyboard ));
@@ -1974,6 +2111,8 @@ LRESULT CALLBACK fgWindowProc( HWND hWnd, UINT uMsg, WPARAM wParam,
         /* Turn on the visibility in case it was turned off somehow */
         window->State.Visible = GL_TRUE;
         InvalidateRect( hWnd, NULL, GL_FALSE ); /* Make sure whole window is repainted. Bit of a hack, but a safe one from what google turns up... */
+        if( window->IsMenu && window->ActiveMenu )
+            window->ActiveMenu->IsDrawn = GL_FALSE;
         BeginPaint( hWnd, &ps );
         fghRedrawWindow( window );
         EndPaint( hWnd, &ps );
@@ -2149,6 +2288,21 @@ LRESULT CALLBACK fgWindowProc( HWND hWnd, UINT uMsg, WPARAM wParam,
 		{
 			int direction = ( fgState.MouseWheelTicks > 0 ) ? 1 : -1;
 
+            /* The wheel scrolls an open menu that is too long to show */
+            if( window->ActiveMenu )
+            {
+                POINT mouse_pos;
+                GetCursorPos( &mouse_pos );
+
+                while( abs ( fgState.MouseWheelTicks ) >= 120 )
+                {
+                    fgScrollActiveMenu( window, -direction,
+                                        mouse_pos.x, mouse_pos.y );
+                    fgState.MouseWheelTicks -= 120 * direction;
+                }
+                break;
+            }
+
             if( ! FETCH_WCB( *window, MouseWheel ) &&
                 ! FETCH_WCB( *window, Mouse ) )
                 break;
@@ -2261,9 +2415,10 @@ LRESULT CALLBACK fgWindowProc( HWND hWnd, UINT uMsg, WPARAM wParam,
 
         case VK_DELETE:
             /* The delete key should be treated as an ASCII keypress: */
-            INVOKE_WCB( *window, Keyboard,
-                        ( 127, window->State.MouseX, window->State.MouseY )
-            );
+            if( ! window->ActiveMenu )
+                INVOKE_WCB( *window, Keyboard,
+                            ( 127, window->State.MouseX, window->State.MouseY )
+                );
         }
 
 #if defined(_WIN32_WCE)
@@ -2288,7 +2443,13 @@ LRESULT CALLBACK fgWindowProc( HWND hWnd, UINT uMsg, WPARAM wParam,
         }
 #endif
 
-        if( keypress != -1 )
+        /* An open menu takes the keyboard, see fgMenuKeyboard() */
+        if( window->ActiveMenu )
+        {
+            if( keypress != -1 )
+                fgMenuKeyboard( window->ActiveMenu, 0, keypress );
+        }
+        else if( keypress != -1 )
             INVOKE_WCB( *window, Special,
                         ( keypress,
                           window->State.MouseX, window->State.MouseY )
@@ -2399,6 +2560,13 @@ LRESULT CALLBACK fgWindowProc( HWND hWnd, UINT uMsg, WPARAM wParam,
       if( (fgState.KeyRepeat==GLUT_KEY_REPEAT_OFF || window->State.IgnoreKeyRepeat==GL_TRUE) && (HIWORD(lParam) & KF_REPEAT) )
             break;
 
+        /* An open menu takes the keyboard, see fgMenuKeyboard() */
+        if( window->ActiveMenu )
+        {
+            fgMenuKeyboard( window->ActiveMenu, (unsigned char)wParam, -1 );
+            break;
+        }
+
         fgState.Modifiers = fghGetWin32Modifiers( );
         INVOKE_WCB( *window, Keyboard,
                     ( (char)wParam,
@@ -29,6 +29,8 @@
 #include <GL/freeglut.h>
 #include "freeglut_internal.h"
 
+#include <ctype.h>
+
 /* -- DEFINITIONS ---------------------------------------------------------- */
 
 /*
@@ -63,6 +65,12 @@
                                 FREEGLUT_MENU_BORDER)
 #define  FREEGLUT_MENU_BORDER   2
 
+/*
+ * FREEGLUT_MENU_SCROLL_DELAY is how many milliseconds a menu waits between
+ * rows when it scrolls because the mouse rests on one of its arrows.
+ */
+#define  FREEGLUT_MENU_SCROLL_DELAY  100
+
 
 /*
  * These variables are for rendering the freeglut menu items.
@@ -90,23 +98,53 @@ extern void fghGetCursorPos(SFG_XYUse *mouse_pos);
 /* -- PRIVATE FUNCTIONS ---------------------------------------------------- */
 
 /*
- * Private function to find a menu entry by index
+ * Private function to find a menu entry by index, starting from one
  */
 static SFG_MenuEntry *fghFindMenuEntry( SFG_Menu* menu, int index )
 {
-    SFG_MenuEntry *entry;
-    int i = 1;
+    if( ( index < 1 ) || ( index > menu->NumEntries ) )
+        return NULL;
+
+    return menu->Entries[ index - 1 ];
+}
 
-    for( entry = (SFG_MenuEntry *)menu->Entries.First;
-         entry;
-         entry = (SFG_MenuEntry *)entry->Node.Next )
+/*
+ * Private function to add an entry to the bottom of a menu, growing the
+ * entry array by doubling so that building a menu stays linear
+ */
+static void fghAppendMenuEntry( SFG_Menu* menu, SFG_MenuEntry* menuEntry )
+{
+    if( menu->NumEntries == menu->EntriesSize )
     {
-        if( i == index )
-            break;
-        ++i;
+        int size = menu->EntriesSize ? 2 * menu->EntriesSize : 16;
+        SFG_MenuEntry** entries = (SFG_MenuEntry **)realloc(
+            menu->Entries, size * sizeof( SFG_MenuEntry* ) );
+
+        if( !entries )
+            fgError( "Out of memory. Could not add a menu entry." );
+
+        menu->Entries = entries;
+        menu->EntriesSize = size;
     }
 
-    return entry;
+    menuEntry->Ordinal = menu->NumEntries;
+    menu->Entries[ menu->NumEntries++ ] = menuEntry;
+}
+
+/*
+ * Private function to take an entry out of a menu, given its index
+ * starting from one, closing up the gap it leaves
+ */
+static void fghRemoveMenuEntry( SFG_Menu* menu, int index )
+{
+    int i;
+
+    memmove( menu->Entries + index - 1, menu->Entries + index,
+             ( menu->NumEntries - index ) * sizeof( SFG_MenuEntry* ) );
+    menu->NumEntries--;
+
+    for( i = index - 1; i < menu->NumEntries; i++ )
+        menu->Entries[ i ]->Ordinal = i;
 }
 
 /*
@@ -114,7 +152,9 @@ static SFG_MenuEntry *fghFindMenuEntry( SFG_Menu* menu, int index )
  */
 static void fghDeactivateSubMenu( SFG_MenuEntry *menuEntry )
 {
-    SFG_MenuEntry *subMenuIter;
+    SFG_Menu *subMenu = menuEntry->SubMenu;
+    int i;
+
     /* Hide the present menu's window */
     fgSetWindow( menuEntry->SubMenu->Window );
     glutHideWindow( );
@@ -123,12 +163,14 @@ static void fghDeactivateSubMenu( SFG_MenuEntry *menuEntry )
     menuEntry->SubMenu->Window->ActiveMenu = NULL;
     menuEntry->SubMenu->IsActive = GL_FALSE;
     menuEntry->SubMenu->ActiveEntry = NULL;
+    menuEntry->SubMenu->IsDrawn = GL_FALSE;
+    menuEntry->SubMenu->ScrollArrow = 0;
 
     /* Hide all submenu windows, and the root menu's window. */
-    for ( subMenuIter = (SFG_MenuEntry *)menuEntry->SubMenu->Entries.First;
-          subMenuIter;
-          subMenuIter = (SFG_MenuEntry *)subMenuIter->Node.Next )
+    for ( i = 0; i < subMenu->NumEntries; i++ )
     {
+        SFG_MenuEntry *subMenuIter = subMenu->Entries[ i ];
+
         subMenuIter->IsActive = GL_FALSE;
 
         /* Is that an active submenu by any case? */
@@ -170,6 +212,172 @@ static GLvoid fghGetVMaxExtent( SFG_Window* window, int* x, int* y )
     }
 }
 
+/*
+ * Private function returning where the first entry row starts: below
+ * the border, and below the up arrow when the menu scrolls
+ */
+static int fghMenuRowsTop( SFG_Menu* menu )
+{
+    if( menu->NumRows < menu->NumEntries )
+        return FREEGLUT_MENU_BORDER + FREEGLUT_MENU_HEIGHT;
+
+    return FREEGLUT_MENU_BORDER;
+}
+
+/*
+ * Private function to decide how many entry rows a menu shows at once.
+ * That is all of them, unless there are more than GLUT_MENU_MAX_ROWS
+ * or than will fit into max_height pixels (no limit if zero); then the
+ * menu scrolls, with an arrow row above and below the entries.
+ */
+static void fghLayoutMenuRows( SFG_Menu* menu, int max_height )
+{
+    int rows = menu->NumEntries;
+    int height, first;
+
+    if( ( fgState.MenuMaxRows > 0 ) && ( rows > fgState.MenuMaxRows ) )
+        rows = fgState.MenuMaxRows;
+
+    if( ( max_height > 0 ) &&
+        ( rows * FREEGLUT_MENU_HEIGHT + 2 * FREEGLUT_MENU_BORDER > max_height ) )
+        rows = ( max_height - 2 * FREEGLUT_MENU_BORDER ) / FREEGLUT_MENU_HEIGHT;
+
+    if( rows < menu->NumEntries )
+    {
+        if( ( max_height > 0 ) &&
+            ( ( rows + 2 ) * FREEGLUT_MENU_HEIGHT +
+              2 * FREEGLUT_MENU_BORDER > max_height ) )
+            rows = ( max_height - 2 * FREEGLUT_MENU_BORDER ) /
+                   FREEGLUT_MENU_HEIGHT - 2;
+        if( rows < 1 )
+            rows = 1;
+    }
+
+    height = rows * FREEGLUT_MENU_HEIGHT + 2 * FREEGLUT_MENU_BORDER;
+    if( rows < menu->NumEntries )
+        height += 2 * FREEGLUT_MENU_HEIGHT;
+
+    first = menu->FirstRow;
+    if( first > menu->NumEntries - rows )
+        first = menu->NumEntries - rows;
+    if( first < 0 )
+        first = 0;
+
+    if( ( rows != menu->NumRows ) || ( height != menu->Height ) ||
+        ( first != menu->FirstRow ) )
+        menu->BodyChanged = GL_TRUE;
+
+    menu->NumRows = rows;
+    menu->FirstRow = first;
+    menu->Height = height;
+}
+
+/*
+ * Private function to scroll a menu by a number of rows, negative to
+ * go up.  The highlight is taken off, and its submenu closed, first.
+ */
+static void fghScrollMenu( SFG_Menu* menu, int rows )
+{
+    int first = menu->FirstRow + rows;
+
+    if( first > menu->NumEntries - menu->NumRows )
+        first = menu->NumEntries - menu->NumRows;
+    if( first < 0 )
+        first = 0;
+
+    if( menu->ActiveEntry )
+    {
+        if( menu->ActiveEntry->SubMenu )
+            fghDeactivateSubMenu( menu->ActiveEntry );
+        menu->ActiveEntry->IsActive = GL_FALSE;
+        menu->ActiveEntry = NULL;
+        menu->Window->State.Redisplay = GL_TRUE;
+    }
+
+    if( first != menu->FirstRow )
+    {
+        menu->FirstRow = first;
+        menu->BodyChanged = GL_TRUE;
+        menu->Window->State.Redisplay = GL_TRUE;
+    }
+}
+
+/*
+ * While the cursor rests on a scroll arrow, a chain of timers scrolls the
+ * menu a row per tick. Each time the cursor gets onto an arrow a new
+ * chain is started; a tick from an older chain, or one finding the
+ * cursor gone from the arrow, ends its chain.
+ */
+static int fghMenuScrollChain = 0;
+static int fghMenuScrollMenuID = 0;
+
+static void fghMenuScrollTick( int chain )
+{
+    SFG_Menu* menu;
+    int first;
+
+    if( chain != fghMenuScrollChain )
+        return;
+    menu = fgMenuByID( fghMenuScrollMenuID );
+    if( !menu || !menu->IsActive || !menu->ScrollArrow )
+        return;
+
+    first = menu->FirstRow;
+    fghScrollMenu( menu, menu->ScrollArrow );
+
+    /* Stop once the menu can scroll no further that way */
+    if( menu->FirstRow != first )
+        glutTimerFunc( FREEGLUT_MENU_SCROLL_DELAY, fghMenuScrollTick, chain );
+}
+
+static GLboolean fghCheckMenuStatus( SFG_Menu* menu );
+
+/*
+ * Private function to open the submenu of a menu entry beside its row
+ */
+static void fghOpenSubMenu( SFG_Menu* menu, SFG_MenuEntry* menuEntry )
+{
+    int max_x, max_y;
+    SFG_Window *current_window = fgStructure.CurrentWindow;
+    SFG_Menu *subMenu = menuEntry->SubMenu;
+
+    /* Set up the initial menu position now... */
+    subMenu->IsActive = GL_TRUE;
+
+    /* Set up the initial submenu position now: */
+    fghGetVMaxExtent(menu->ParentWindow, &max_x, &max_y);
+    subMenu->FirstRow = 0;
+    fghLayoutMenuRows( subMenu, max_y );
+    subMenu->X = menu->X + menu->Width;
+    subMenu->Y = menu->Y + fghMenuRowsTop( menu ) - FREEGLUT_MENU_BORDER +
+        ( menuEntry->Ordinal - menu->FirstRow ) * FREEGLUT_MENU_HEIGHT;
+
+    if( subMenu->X + subMenu->Width > max_x )
+        subMenu->X = menu->X - subMenu->Width;
+
+    if( subMenu->Y + subMenu->Height > max_y )
+    {
+        subMenu->Y -= ( subMenu->Height -
+                        FREEGLUT_MENU_HEIGHT -
+                        2 * FREEGLUT_MENU_BORDER );
+        if( subMenu->Y < 0 )
+            subMenu->Y = 0;
+    }
+
+    fgSetWindow( subMenu->Window );
+    glutPositionWindow( subMenu->X, subMenu->Y );
+    glutReshapeWindow( subMenu->Width, subMenu->Height );
+    glutPopWindow( );
+    glutShowWindow( );
+    subMenu->Window->ActiveMenu = subMenu;
+    fgSetWindow( current_window );
+    subMenu->Window->State.MouseX =
+        menu->Window->State.MouseX + menu->X - subMenu->X;
+    subMenu->Window->State.MouseY =
+        menu->Window->State.MouseY + menu->Y - subMenu->Y;
+    fghCheckMenuStatus( subMenu );
+}
+
 /*
  * Private function to check for the current menu/sub menu activity state
  */
@@ -178,29 +386,28 @@ static GLboolean fghCheckMenuStatus( SFG_Menu* menu )
     SFG_MenuEntry* menuEntry;
     int x, y;
 
-    /* First of all check any of the active sub menus... */
-    for( menuEntry = (SFG_MenuEntry *)menu->Entries.First;
-         menuEntry;
-         menuEntry = (SFG_MenuEntry *)menuEntry->Node.Next )
+    /*
+     * First of all check the active sub menu, if any.  Only the active
+     * entry can be highlighted, so that is the one to look at...
+     */
+    menuEntry = menu->ActiveEntry;
+    if( menuEntry && menuEntry->SubMenu && menuEntry->IsActive )
     {
-        if( menuEntry->SubMenu && menuEntry->IsActive )
-        {
-            /*
-             * OK, have the sub-menu checked, too. If it returns GL_TRUE, it
-             * will mean that it caught the mouse cursor and we do not need
-             * to regenerate the activity list, and so our parents do...
-             */
-            GLboolean return_status;
+        /*
+         * OK, have the sub-menu checked, too. If it returns GL_TRUE, it
+         * will mean that it caught the mouse cursor and we do not need
+         * to regenerate the activity list, and so our parents do...
+         */
+        GLboolean return_status;
 
-            menuEntry->SubMenu->Window->State.MouseX =
-                menu->Window->State.MouseX + menu->X - menuEntry->SubMenu->X;
-            menuEntry->SubMenu->Window->State.MouseY =
-                menu->Window->State.MouseY + menu->Y - menuEntry->SubMenu->Y;
-            return_status = fghCheckMenuStatus( menuEntry->SubMenu );
+        menuEntry->SubMenu->Window->State.MouseX =
+            menu->Window->State.MouseX + menu->X - menuEntry->SubMenu->X;
+        menuEntry->SubMenu->Window->State.MouseY =
+            menu->Window->State.MouseY + menu->Y - menuEntry->SubMenu->Y;
+        return_status = fghCheckMenuStatus( menuEntry->SubMenu );
 
-            if ( return_status )
-                return GL_TRUE;
-        }
+        if ( return_status )
+            return GL_TRUE;
     }
 
     /* That much about our sub menus, let's get to checking the current menu: */
@@ -213,7 +420,31 @@ static GLboolean fghCheckMenuStatus( SFG_Menu* menu )
         ( y >= FREEGLUT_MENU_BORDER ) &&
         ( y < menu->Height - FREEGLUT_MENU_BORDER )  )
     {
-        int menuID = ( y - FREEGLUT_MENU_BORDER ) / FREEGLUT_MENU_HEIGHT;
+        int top = fghMenuRowsTop( menu );
+        int menuID;
+
+        /*
+         * Getting onto a scroll arrow moves the entries by a row, and
+         * then by another each tick while the cursor stays there
+         */
+        if( ( y < top ) ||
+            ( y >= top + menu->NumRows * FREEGLUT_MENU_HEIGHT ) )
+        {
+            int arrow = ( y < top ) ? -1 : 1;
+
+            if( menu->ScrollArrow != arrow )
+            {
+                menu->ScrollArrow = arrow;
+                fghScrollMenu( menu, arrow );
+                fghMenuScrollMenuID = menu->ID;
+                glutTimerFunc( FREEGLUT_MENU_SCROLL_DELAY, fghMenuScrollTick,
+                               ++fghMenuScrollChain );
+            }
+            return GL_TRUE;
+        }
+
+        menu->ScrollArrow = 0;
+        menuID = menu->FirstRow + ( y - top ) / FREEGLUT_MENU_HEIGHT;
 
         /* The mouse cursor is somewhere over our box, check it out. */
         menuEntry = fghFindMenuEntry( menu, menuID + 1 );
@@ -221,7 +452,6 @@ static GLboolean fghCheckMenuStatus( SFG_Menu* menu )
                                       "fghCheckMenuStatus" );
 
         menuEntry->IsActive = GL_TRUE;
-        menuEntry->Ordinal = menuID;
 
         /*
          * If this is not the same as the last active menu entry, deactivate
@@ -250,46 +480,7 @@ static GLboolean fghCheckMenuStatus( SFG_Menu* menu )
         if( menuEntry->SubMenu )
         {
             if ( ! menuEntry->SubMenu->IsActive )
-            {
-                int max_x, max_y;
-                SFG_Window *current_window = fgStructure.CurrentWindow;
-
-                /* Set up the initial menu position now... */
-                menuEntry->SubMenu->IsActive = GL_TRUE;
-
-                /* Set up the initial submenu position now: */
-                fghGetVMaxExtent(menu->ParentWindow, &max_x, &max_y);
-                menuEntry->SubMenu->X = menu->X + menu->Width;
-                menuEntry->SubMenu->Y = menu->Y +
-                    menuEntry->Ordinal * FREEGLUT_MENU_HEIGHT;
-
-                if( menuEntry->SubMenu->X + menuEntry->SubMenu->Width > max_x )
-                    menuEntry->SubMenu->X = menu->X - menuEntry->SubMenu->Width;
-
-                if( menuEntry->SubMenu->Y + menuEntry->SubMenu->Height > max_y )
-                {
-                    menuEntry->SubMenu->Y -= ( menuEntry->SubMenu->Height -
-                                               FREEGLUT_MENU_HEIGHT -
-                                               2 * FREEGLUT_MENU_BORDER );
-                    if( menuEntry->SubMenu->Y < 0 )
-                        menuEntry->SubMenu->Y = 0;
-                }
-
-                fgSetWindow( menuEntry->SubMenu->Window );
-                glutPositionWindow( menuEntry->SubMenu->X,
-                                    menuEntry->SubMenu->Y );
-                glutReshapeWindow( menuEntry->SubMenu->Width,
-                                   menuEntry->SubMenu->Height );
-                glutPopWindow( );
-                glutShowWindow( );
-                menuEntry->SubMenu->Window->ActiveMenu = menuEntry->SubMenu;
-                fgSetWindow( current_window );
-                menuEntry->SubMenu->Window->State.MouseX =
-                    x + menu->X - menuEntry->SubMenu->X;
-                menuEntry->SubMenu->Window->State.MouseY =
-                    y + menu->Y - menuEntry->SubMenu->Y;
-                fghCheckMenuStatus( menuEntry->SubMenu );
-            }
+                fghOpenSubMenu( menu, menuEntry );
 
             /* Activate it because its parent entry is active */
             menuEntry->SubMenu->IsActive = GL_TRUE;  /* XXX Do we need this? */
@@ -300,6 +491,7 @@ static GLboolean fghCheckMenuStatus( SFG_Menu* menu )
     }
 
     /* Looks like the menu cursor is somewhere else... */
+    menu->ScrollArrow = 0;
     if( menu->ActiveEntry && menu->ActiveEntry->IsActive &&
         ( !menu->ActiveEntry->SubMenu ||
           !menu->ActiveEntry->SubMenu->IsActive ) )
@@ -313,11 +505,64 @@ static GLboolean fghCheckMenuStatus( SFG_Menu* menu )
 }
 
 /*
- * Displays a menu box and all of its submenus (if they are active)
+ * Draws the row of the menu entry with index i, which must be one of
+ * the rows shown: the label and, for a submenu, its arrow.  The row
+ * background is painted first when a colour is given, which is how a
+ * highlight is put on or taken off without touching the rest.
+ */
+static void fghDisplayMenuEntry( SFG_Menu* menu, SFG_MenuEntry* menuEntry,
+                                 int i, const float* back, const float* fore )
+{
+    int border = FREEGLUT_MENU_BORDER;
+    int y_base = fghMenuRowsTop( menu ) +
+                 ( i - menu->FirstRow )*FREEGLUT_MENU_HEIGHT;
+
+    if( back )
+    {
+        glColor4fv( back );
+        glBegin( GL_QUADS );
+            glVertex2i( border,               y_base );
+            glVertex2i( menu->Width - border, y_base );
+            glVertex2i( menu->Width - border, y_base + FREEGLUT_MENU_HEIGHT );
+            glVertex2i( border,               y_base + FREEGLUT_MENU_HEIGHT );
+        glEnd( );
+    }
+
+    glColor4fv( fore );
+
+    /* Move the raster into position... */
+    /* Try to center the text - JCJ 31 July 2003*/
+    glRasterPos2i(
+        2 * border,
+        y_base + FREEGLUT_MENU_HEIGHT - border -
+        ( int )( FREEGLUT_MENU_HEIGHT*0.3 - border )
+    );
+
+    /* Have the label drawn, character after character: */
+    glutBitmapString( FREEGLUT_MENU_FONT,
+                      (unsigned char *)menuEntry->Text);
+
+    /* If it's a submenu, draw a right arrow */
+    if( menuEntry->SubMenu )
+    {
+        int width = glutBitmapWidth( FREEGLUT_MENU_FONT, '_' );
+        int x_base = menu->Width - 2 - width;
+        glBegin( GL_TRIANGLES );
+            glVertex2i( x_base, y_base + 2*border);
+            glVertex2i( menu->Width - 2, y_base +
+                        ( FREEGLUT_MENU_HEIGHT + border) / 2 );
+            glVertex2i( x_base, y_base + FREEGLUT_MENU_HEIGHT - border );
+        glEnd( );
+    }
+}
+
+/*
+ * Draws the static body of a menu box: the bevel, the background and
+ * every entry unhighlighted.  This is what goes into the menu's display
+ * list, the highlight is drawn over it separately.
  */
 static void fghDisplayMenuBox( SFG_Menu* menu )
 {
-    SFG_MenuEntry *menuEntry;
     int i;
     int border = FREEGLUT_MENU_BORDER;
 
@@ -355,95 +600,74 @@ static void fghDisplayMenuBox( SFG_Menu* menu )
         glVertex2i(               border, menu->Height - border);
     glEnd( );
 
-    /* Check if any of the submenus is currently active... */
-    for( menuEntry = (SFG_MenuEntry *)menu->Entries.First;
-         menuEntry;
-         menuEntry = (SFG_MenuEntry *)menuEntry->Node.Next )
+    /* Print the menu entries now, just the rows that are shown... */
+    for( i = menu->FirstRow; i < menu->FirstRow + menu->NumRows; i++ )
+        fghDisplayMenuEntry( menu, menu->Entries[ i ], i,
+                             NULL, menu_pen_fore );
+
+    /* A scrolling menu gets arrows for the ways it can still go */
+    if( menu->NumRows < menu->NumEntries )
     {
-        /* Has the menu been marked as active, maybe? */
-        if( menuEntry->IsActive )
+        int x_mid = menu->Width / 2;
+        int half = FREEGLUT_MENU_HEIGHT / 2 - border;
+        int y_top = border + FREEGLUT_MENU_HEIGHT / 2;
+        int y_bottom = menu->Height - border - FREEGLUT_MENU_HEIGHT / 2;
+
+        glColor4fv( menu_pen_fore );
+        glBegin( GL_TRIANGLES );
+        if( menu->FirstRow > 0 )
         {
-            /*
-             * That's truly right, and we need to have it highlighted.
-             * There is an assumption that mouse cursor didn't move
-             * since the last check of menu activity state:
-             */
-            int menuID = menuEntry->Ordinal;
-
-            /* So have the highlight drawn... */
-            glColor4fv( menu_pen_hback );
-            glBegin( GL_QUADS );
-                glVertex2i( border,
-                            (menuID + 0)*FREEGLUT_MENU_HEIGHT + border );
-                glVertex2i( menu->Width - border,
-                            (menuID + 0)*FREEGLUT_MENU_HEIGHT + border );
-                glVertex2i( menu->Width - border,
-                            (menuID + 1)*FREEGLUT_MENU_HEIGHT + border );
-                glVertex2i( border,
-                            (menuID + 1)*FREEGLUT_MENU_HEIGHT + border );
-            glEnd( );
+            glVertex2i( x_mid - half, y_top + half / 2 );
+            glVertex2i( x_mid + half, y_top + half / 2 );
+            glVertex2i( x_mid       , y_top - half / 2 );
         }
-    }
-
-    /* Print the menu entries now... */
-
-    glColor4fv( menu_pen_fore );
-
-    for( menuEntry = (SFG_MenuEntry *)menu->Entries.First, i = 0;
-         menuEntry;
-         menuEntry = (SFG_MenuEntry *)menuEntry->Node.Next, ++i )
-    {
-        /* If the menu entry is active, set the color to white */
-        if( menuEntry->IsActive )
-            glColor4fv( menu_pen_hfore );
-
-        /* Move the raster into position... */
-        /* Try to center the text - JCJ 31 July 2003*/
-        glRasterPos2i(
-            2 * border,
-            ( i + 1 )*FREEGLUT_MENU_HEIGHT -
-            ( int )( FREEGLUT_MENU_HEIGHT*0.3 - border )
-        );
-
-        /* Have the label drawn, character after character: */
-        glutBitmapString( FREEGLUT_MENU_FONT,
-                          (unsigned char *)menuEntry->Text);
-
-        /* If it's a submenu, draw a right arrow */
-        if( menuEntry->SubMenu )
+        if( menu->FirstRow + menu->NumRows < menu->NumEntries )
         {
-            int width = glutBitmapWidth( FREEGLUT_MENU_FONT, '_' );
-            int x_base = menu->Width - 2 - width;
-            int y_base = i*FREEGLUT_MENU_HEIGHT + border;
-            glBegin( GL_TRIANGLES );
-                glVertex2i( x_base, y_base + 2*border);
-                glVertex2i( menu->Width - 2, y_base +
-                            ( FREEGLUT_MENU_HEIGHT + border) / 2 );
-                glVertex2i( x_base, y_base + FREEGLUT_MENU_HEIGHT - border );
-            glEnd( );
+            glVertex2i( x_mid - half, y_bottom - half / 2 );
+            glVertex2i( x_mid       , y_bottom + half / 2 );
+            glVertex2i( x_mid + half, y_bottom - half / 2 );
         }
-
-        /* If the menu entry is active, reset the color */
-        if( menuEntry->IsActive )
-            glColor4fv( menu_pen_fore );
+        glEnd( );
     }
 }
 
+/*
+ * Returns the highlighted entry of a menu, if there is one
+ */
+static SFG_MenuEntry* fghHighlightedMenuEntry( SFG_Menu* menu )
+{
+    if( menu->ActiveEntry && menu->ActiveEntry->IsActive )
+        return menu->ActiveEntry;
+
+    return NULL;
+}
+
 /*
  * Private static function to set the parent window of a submenu and all
  * of its submenus
  */
 static void fghSetMenuParentWindow( SFG_Window *window, SFG_Menu *menu )
 {
-    SFG_MenuEntry *menuEntry;
+    int i;
 
     menu->ParentWindow = window;
 
-    for( menuEntry = ( SFG_MenuEntry * )menu->Entries.First;
-         menuEntry;
-         menuEntry = ( SFG_MenuEntry * )menuEntry->Node.Next )
-        if( menuEntry->SubMenu )
-            fghSetMenuParentWindow( window, menuEntry->SubMenu );
+    for( i = 0; i < menu->NumEntries; i++ )
+        if( menu->Entries[ i ]->SubMenu )
+            fghSetMenuParentWindow( window, menu->Entries[ i ]->SubMenu );
+}
+
+/*
+ * Private function telling whether the cursor is on a scroll arrow of
+ * the innermost open menu, where a click scrolls rather than selects
+ */
+static GLboolean fghOnMenuScrollArrow( SFG_Menu* menu )
+{
+    while( menu->ActiveEntry && menu->ActiveEntry->SubMenu &&
+           menu->ActiveEntry->SubMenu->IsActive )
+        menu = menu->ActiveEntry->SubMenu;
+
+    return menu->ScrollArrow != 0;
 }
 
 /*
@@ -451,39 +675,66 @@ static void fghSetMenuParentWindow( SFG_Window *window, SFG_Menu *menu )
  */
 static void fghExecuteMenuCallback( SFG_Menu* menu )
 {
-    SFG_MenuEntry *menuEntry;
+    /* The active entry is the only one that can be highlighted... */
+    SFG_MenuEntry *menuEntry = menu->ActiveEntry;
 
-    /* First of all check any of the active sub menus... */
-    for( menuEntry = (SFG_MenuEntry *)menu->Entries.First;
-         menuEntry;
-         menuEntry = (SFG_MenuEntry *)menuEntry->Node.Next)
-    {
-        if( menuEntry->IsActive )
+    if( !menuEntry || !menuEntry->IsActive )
+        return;
+
+    if( menuEntry->SubMenu )
+        fghExecuteMenuCallback( menuEntry->SubMenu );
+    else
+        if( menu->Callback )
         {
-            if( menuEntry->SubMenu )
-                fghExecuteMenuCallback( menuEntry->SubMenu );
-            else
-                if( menu->Callback )
-                {
-                    SFG_Menu *save_menu = fgStructure.CurrentMenu;
-                    fgStructure.CurrentMenu = menu;
-                    menu->Callback( menuEntry->ID );
-                    fgStructure.CurrentMenu = save_menu;
-                }
-
-            return;
+            SFG_Menu *save_menu = fgStructure.CurrentMenu;
+            fgStructure.CurrentMenu = menu;
+            menu->Callback( menuEntry->ID );
+            fgStructure.CurrentMenu = save_menu;
         }
-    }
 }
 
+/*
+ * Private function to invoke the callback for the highlighted entry, if
+ * any, and close the menus
+ */
+static void fghSelectMenuEntry( SFG_Menu* menu )
+{
+    /*
+     * Save the current window and menu and set the current
+     * window to the window whose menu this is
+     */
+    SFG_Window *save_window = fgStructure.CurrentWindow;
+    SFG_Menu *save_menu = fgStructure.CurrentMenu;
+    SFG_Window *parent_window = menu->ParentWindow;
+    fgSetWindow( parent_window );
+    fgStructure.CurrentMenu = menu;
+
+    /* Execute the menu callback */
+    fghExecuteMenuCallback( menu );
+    fgDeactivateMenu( parent_window );
+
+    /* Restore the current window and menu */
+    fgSetWindow( save_window );
+    fgStructure.CurrentMenu = save_menu;
+}
 
 /*
  * Displays the currently active menu for the current window
+ *
+ * The menu window has a context of its own, so the state it needs is
+ * simply set rather than pushed and popped around the drawing.  The
+ * static body is compiled into a display list the first time it is
+ * drawn after its entries changed; a full redraw is then one call of
+ * that list plus the highlighted row.  When only the highlight moved
+ * and the window still shows the last full redraw, just the rows that
+ * lost and gained the highlight are redrawn, straight into the front
+ * buffer, so pointer motion costs two rows instead of the whole menu.
  */
 void fgDisplayMenu( void )
 {
     SFG_Window* window = fgStructure.CurrentWindow;
     SFG_Menu* menu = NULL;
+    SFG_MenuEntry* highlighted;
 
     FREEGLUT_INTERNAL_ERROR_EXIT ( fgStructure.CurrentWindow, "Displaying menu in nonexistent window",
                                    "fgDisplayMenu" );
@@ -494,8 +745,34 @@ void fgDisplayMenu( void )
 
     fgSetWindow( menu->Window );
 
-    glPushAttrib( GL_DEPTH_BUFFER_BIT | GL_TEXTURE_BIT | GL_LIGHTING_BIT |
-                  GL_POLYGON_BIT );
+    highlighted = fghHighlightedMenuEntry( menu );
+
+    if( menu->IsDrawn && menu->BodyList && ! menu->BodyChanged )
+    {
+        SFG_MenuEntry* drawn = NULL;
+        int ordinal = highlighted ? highlighted->Ordinal : -1;
+
+        if( ordinal != menu->DrawnOrdinal )
+        {
+            if( menu->DrawnOrdinal >= 0 )
+                drawn = fghFindMenuEntry( menu, menu->DrawnOrdinal + 1 );
+
+            glDrawBuffer( GL_FRONT );
+            if( drawn )
+                fghDisplayMenuEntry( menu, drawn, menu->DrawnOrdinal,
+                                     menu_pen_back, menu_pen_fore );
+            if( highlighted )
+                fghDisplayMenuEntry( menu, highlighted, ordinal,
+                                     menu_pen_hback, menu_pen_hfore );
+            glDrawBuffer( menu->DrawBuffer );
+            glFlush( );
+
+            menu->DrawnOrdinal = ordinal;
+        }
+
+        fgSetWindow ( window );
+        return;
+    }
 
     glDisable( GL_DEPTH_TEST );
     glDisable( GL_TEXTURE_2D );
@@ -503,7 +780,6 @@ void fgDisplayMenu( void )
     glDisable( GL_CULL_FACE  );
 
     glMatrixMode( GL_PROJECTION );
-    glPushMatrix( );
     glLoadIdentity( );
     glOrtho(
          0, glutGet( GLUT_WINDOW_WIDTH  ),
@@ -512,20 +788,38 @@ void fgDisplayMenu( void )
     );
 
     glMatrixMode( GL_MODELVIEW );
-    glPushMatrix( );
     glLoadIdentity( );
 
-    fghDisplayMenuBox( menu );
+    if( ! menu->BodyList )
+    {
+        menu->BodyList = glGenLists( 1 );
+        glGetIntegerv( GL_DRAW_BUFFER, &menu->DrawBuffer );
+        menu->BodyChanged = GL_TRUE;
+    }
 
-    glPopAttrib( );
+    if( menu->BodyChanged )
+    {
+        /*
+         * Compile and execute, so that the raster position the bitmap
+         * text may read back is the one just set.
+         */
+        glNewList( menu->BodyList, GL_COMPILE_AND_EXECUTE );
+        fghDisplayMenuBox( menu );
+        glEndList( );
+        menu->BodyChanged = GL_FALSE;
+    }
+    else
+        glCallList( menu->BodyList );
 
-    glMatrixMode( GL_PROJECTION );
-    glPopMatrix( );
-    glMatrixMode( GL_MODELVIEW );
-    glPopMatrix( );
+    if( highlighted )
+        fghDisplayMenuEntry( menu, highlighted, highlighted->Ordinal,
+                             menu_pen_hback, menu_pen_hfore );
 
     glutSwapBuffers( );
 
+    menu->IsDrawn = GL_TRUE;
+    menu->DrawnOrdinal = highlighted ? highlighted->Ordinal : -1;
+
     fgSetWindow ( window );
 }
 
@@ -549,10 +843,13 @@ static void fghActivateMenu( SFG_Window* window, int button )
     window->ActiveMenu = menu;
     menu->IsActive = GL_TRUE;
     fghSetMenuParentWindow ( window, menu );
+    fgStructure.ActiveMenu = menu;
     fgState.ActiveMenus++;
 
     /* Set up the initial menu position now: */
     fghGetVMaxExtent(menu->ParentWindow, &max_x, &max_y);
+    menu->FirstRow = 0;
+    fghLayoutMenuRows( menu, max_y );
     fgSetWindow( window );
     /* get mouse position on screen (window->State.MouseX and window->State.MouseY
      * are relative to client area origin), and not easy to correct given that
@@ -611,6 +908,272 @@ void fgUpdateMenuHighlight ( SFG_Menu *menu )
     fghCheckMenuStatus( menu );
 }
 
+/*
+ * Scrolls the innermost open menu under the given screen position, for
+ * the mouse wheel.  Returns GL_FALSE if the window has no active menu.
+ */
+GLboolean fgScrollActiveMenu ( SFG_Window *window, int rows,
+                               int mouse_x, int mouse_y )
+{
+    SFG_Menu *menu = window->ActiveMenu;
+    SFG_Menu *target = NULL;
+
+    freeglut_return_val_if_fail( menu, GL_FALSE );
+
+    for( ; ; )
+    {
+        if( ( mouse_x >= menu->X ) && ( mouse_x < menu->X + menu->Width ) &&
+            ( mouse_y >= menu->Y ) && ( mouse_y < menu->Y + menu->Height ) )
+            target = menu;
+
+        if( !menu->ActiveEntry || !menu->ActiveEntry->SubMenu ||
+            !menu->ActiveEntry->SubMenu->IsActive )
+            break;
+        menu = menu->ActiveEntry->SubMenu;
+    }
+
+    if( target && ( target->NumRows < target->NumEntries ) )
+    {
+        fghScrollMenu( target, rows );
+
+        /* Have the entry now under the cursor highlighted */
+        target->Window->State.MouseX = mouse_x - target->X;
+        target->Window->State.MouseY = mouse_y - target->Y;
+        fghCheckMenuStatus( target );
+    }
+
+    return GL_TRUE;
+}
+
+/*
+ * Private function to highlight the entry with the given index, closing
+ * the submenu of the one highlighted before and scrolling the new one
+ * into view.  This is what the keyboard moves around.
+ */
+static void fghHighlightMenuEntry( SFG_Menu* menu, int index )
+{
+    SFG_MenuEntry* menuEntry;
+
+    if( menu->NumEntries == 0 )
+        return;
+    if( index < 0 )
+        index = 0;
+    if( index >= menu->NumEntries )
+        index = menu->NumEntries - 1;
+
+    menuEntry = menu->Entries[ index ];
+
+    if( menu->ActiveEntry && ( menu->ActiveEntry != menuEntry ) )
+    {
+        if( menu->ActiveEntry->SubMenu )
+            fghDeactivateSubMenu( menu->ActiveEntry );
+        menu->ActiveEntry->IsActive = GL_FALSE;
+        menu->ActiveEntry = NULL;
+    }
+
+    if( index < menu->FirstRow )
+        fghScrollMenu( menu, index - menu->FirstRow );
+    else if( index >= menu->FirstRow + menu->NumRows )
+        fghScrollMenu( menu, index - menu->FirstRow - menu->NumRows + 1 );
+
+    menuEntry->IsActive = GL_TRUE;
+    menu->ActiveEntry = menuEntry;
+    menu->ScrollArrow = 0;
+    menu->Window->State.Redisplay = GL_TRUE;
+}
+
+/*
+ * Private function comparing labels for the type-ahead index, ignoring
+ * case and looking at no more than n characters
+ */
+static int fghCompareMenuLabels( const char* a, const char* b, size_t n )
+{
+    for( ; n; n--, a++, b++ )
+    {
+        int ca = tolower( ( unsigned char )*a );
+        int cb = tolower( ( unsigned char )*b );
+
+        if( ca != cb )
+            return ca - cb;
+        if( !ca )
+            break;
+    }
+
+    return 0;
+}
+
+static int fghCompareMenuEntries( const void* a, const void* b )
+{
+    const SFG_MenuEntry* ea = *( const SFG_MenuEntry* const * )a;
+    const SFG_MenuEntry* eb = *( const SFG_MenuEntry* const * )b;
+    int result = fghCompareMenuLabels( ea->Text, eb->Text, ( size_t )-1 );
+
+    return result ? result : ea->Ordinal - eb->Ordinal;
+}
+
+/*
+ * The characters typed into a menu so far, forgotten after a pause
+ */
+#define  FREEGLUT_MENU_TYPE_AHEAD_DELAY  1000
+
+static SFG_Menu* fghTypeAheadMenu = NULL;
+static long      fghTypeAheadTime = 0;
+static char      fghTypeAhead[ 64 ];
+static size_t    fghTypeAheadLength = 0;
+
+/*
+ * Private function to highlight the first entry, by label, that starts
+ * with what has been typed into the menu.  The entries are looked up in
+ * a copy of the entry array sorted by label, built the first time it is
+ * needed after the entries change, so each key costs a binary search.
+ */
+static void fghMenuTypeAhead( SFG_Menu* menu, unsigned char key )
+{
+    long now = fgElapsedTime( );
+    int low, high;
+
+    if( ( menu != fghTypeAheadMenu ) ||
+        ( now - fghTypeAheadTime > FREEGLUT_MENU_TYPE_AHEAD_DELAY ) )
+        fghTypeAheadLength = 0;
+    fghTypeAheadMenu = menu;
+    fghTypeAheadTime = now;
+
+    if( ( key == 8 ) || ( key == 127 ) )
+    {
+        if( fghTypeAheadLength )
+            fghTypeAheadLength--;
+    }
+    else if( fghTypeAheadLength < sizeof( fghTypeAhead ) - 1 )
+        fghTypeAhead[ fghTypeAheadLength++ ] = key;
+    fghTypeAhead[ fghTypeAheadLength ] = '\0';
+
+    if( !fghTypeAheadLength || !menu->NumEntries )
+        return;
+
+    if( !menu->SortedEntries )
+    {
+        menu->SortedEntries = (SFG_MenuEntry **)malloc(
+            menu->NumEntries * sizeof( SFG_MenuEntry* ) );
+        if( !menu->SortedEntries )
+            fgError( "Out of memory. Could not index menu entries." );
+
+        memcpy( menu->SortedEntries, menu->Entries,
+                menu->NumEntries * sizeof( SFG_MenuEntry* ) );
+        qsort( menu->SortedEntries, menu->NumEntries,
+               sizeof( SFG_MenuEntry* ), fghCompareMenuEntries );
+    }
+
+    /* Find the first label not sorting before what was typed */
+    low = 0;
+    high = menu->NumEntries;
+    while( low < high )
+    {
+        int middle = ( low + high ) / 2;
+
+        if( fghCompareMenuLabels( menu->SortedEntries[ middle ]->Text,
+                                  fghTypeAhead, fghTypeAheadLength ) < 0 )
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    if( ( low < menu->NumEntries ) &&
+        ! fghCompareMenuLabels( menu->SortedEntries[ low ]->Text,
+                                fghTypeAhead, fghTypeAheadLength ) )
+        fghHighlightMenuEntry( menu, menu->SortedEntries[ low ]->Ordinal );
+}
+
+/*
+ * Handles a key pressed while a menu is open: key is the ASCII code, or
+ * zero for one of the GLUT_KEY_* special keys.
+ *
+ * Up and down move the highlight in the innermost open menu, as do
+ * page up and down, home and end.  Right or Enter opens the submenu of
+ * the highlighted entry and Left or Escape closes it again; Enter on
+ * any other entry selects it, and Escape in the top menu closes it.
+ * Anything printable is type-ahead, see fghMenuTypeAhead().
+ */
+void fgMenuKeyboard( SFG_Menu *menu, unsigned char key, int special )
+{
+    SFG_Menu *parent = NULL;
+    SFG_MenuEntry *active;
+    int index;
+
+    /* Find the innermost open menu */
+    while( menu->ActiveEntry && menu->ActiveEntry->SubMenu &&
+           menu->ActiveEntry->SubMenu->IsActive )
+    {
+        parent = menu;
+        menu = menu->ActiveEntry->SubMenu;
+    }
+
+    active = fghHighlightedMenuEntry( menu );
+    index = active ? active->Ordinal : -1;
+
+    if( !key )
+        switch( special )
+        {
+        case GLUT_KEY_UP:
+            index = ( index > 0 ) ? index - 1 : menu->NumEntries - 1;
+            fghHighlightMenuEntry( menu, index );
+            break;
+
+        case GLUT_KEY_DOWN:
+            index = ( index + 1 < menu->NumEntries ) ? index + 1 : 0;
+            fghHighlightMenuEntry( menu, index );
+            break;
+
+        case GLUT_KEY_PAGE_UP:
+            fghHighlightMenuEntry( menu, index - menu->NumRows );
+            break;
+
+        case GLUT_KEY_PAGE_DOWN:
+            fghHighlightMenuEntry( menu, index + menu->NumRows );
+            break;
+
+        case GLUT_KEY_HOME:
+            fghHighlightMenuEntry( menu, 0 );
+            break;
+
+        case GLUT_KEY_END:
+            fghHighlightMenuEntry( menu, menu->NumEntries - 1 );
+            break;
+
+        case GLUT_KEY_RIGHT:
+            if( active && active->SubMenu )
+            {
+                fghOpenSubMenu( menu, active );
+                fghHighlightMenuEntry( active->SubMenu, 0 );
+            }
+            break;
+
+        case GLUT_KEY_LEFT:
+            if( parent )
+                fghDeactivateSubMenu( parent->ActiveEntry );
+            break;
+        }
+    else if( ( key == '\r' ) || ( key == '\n' ) )
+    {
+        if( active && active->SubMenu )
+        {
+            fghOpenSubMenu( menu, active );
+            fghHighlightMenuEntry( active->SubMenu, 0 );
+        }
+        else if( active )
+            /* The top menu is the one the window it was opened in has */
+            fghSelectMenuEntry( menu->ParentWindow->ActiveMenu );
+    }
+    else if( key == 27 )
+    {
+        if( parent )
+            fghDeactivateSubMenu( parent->ActiveEntry );
+        else
+            fgDeactivateMenu( menu->ParentWindow );
+    }
+    else if( ( key >= ' ' ) || ( key == 8 ) )
+        fghMenuTypeAhead( menu, key );
+}
+
 /*
  * Check whether an active menu absorbs a mouse click
  */
@@ -643,26 +1206,14 @@ GLboolean fgCheckActiveMenu ( SFG_Window *window, int button, GLboolean pressed,
                                        mouse_y - window->ActiveMenu->Y;
         }
 
-        /* In the menu, invoke the callback and deactivate the menu */
+        /*
+         * In the menu, invoke the callback and deactivate the menu,
+         * unless the click was on a scroll arrow, which only scrolls
+         */
         if( fghCheckMenuStatus( window->ActiveMenu ) )
         {
-            /*
-             * Save the current window and menu and set the current
-             * window to the window whose menu this is
-             */
-            SFG_Window *save_window = fgStructure.CurrentWindow;
-            SFG_Menu *save_menu = fgStructure.CurrentMenu;
-            SFG_Window *parent_window = window->ActiveMenu->ParentWindow;
-            fgSetWindow( parent_window );
-            fgStructure.CurrentMenu = window->ActiveMenu;
-
-            /* Execute the menu callback */
-            fghExecuteMenuCallback( window->ActiveMenu );
-            fgDeactivateMenu( parent_window );
-
-            /* Restore the current window and menu */
-            fgSetWindow( save_window );
-            fgStructure.CurrentMenu = save_menu;
+            if( ! fghOnMenuScrollArrow( window->ActiveMenu ) )
+                fghSelectMenuEntry( window->ActiveMenu );
         }
         else if( pressed )
             /*
@@ -708,6 +1259,7 @@ void fgDeactivateMenu( SFG_Window *window )
     SFG_Window *parent_window = NULL;
     SFG_Menu* menu;
     SFG_MenuEntry *menuEntry;
+    int i;
 
     /* Did we find an active window? */
     freeglut_return_if_fail( window );
@@ -727,14 +1279,17 @@ void fgDeactivateMenu( SFG_Window *window )
     fghSetMenuParentWindow ( NULL, menu );
     menu->IsActive = GL_FALSE;
     menu->ActiveEntry = NULL;
+    menu->IsDrawn = GL_FALSE;
+    menu->ScrollArrow = 0;
 
+    if( fgStructure.ActiveMenu == menu )
+        fgStructure.ActiveMenu = NULL;
     fgState.ActiveMenus--;
 
     /* Hide all submenu windows, and the root menu's window. */
-    for ( menuEntry = ( SFG_MenuEntry * )menu->Entries.First;
-          menuEntry;
-          menuEntry = ( SFG_MenuEntry * )menuEntry->Node.Next )
+    for ( i = 0; i < menu->NumEntries; i++ )
     {
+        menuEntry = menu->Entries[ i ];
         menuEntry->IsActive = GL_FALSE;
 
         /* Is that an active submenu by any chance? */
@@ -766,47 +1321,57 @@ void fgDeactivateMenu( SFG_Window *window )
 }
 
 /*
- * Recalculates current menu's box size
+ * Measures a menu entry's label, keeping the result in its Width field
  */
-void fghCalculateMenuBoxSize( void )
+static void fghMeasureMenuEntry( SFG_MenuEntry* menuEntry )
 {
-    SFG_MenuEntry* menuEntry;
-    int width = 0, height = 0;
+    /* Update the menu entry's width value */
+    menuEntry->Width = glutBitmapLength(
+        FREEGLUT_MENU_FONT,
+        (unsigned char *)menuEntry->Text
+    );
 
-    /* Make sure there is a current menu set */
-    freeglut_return_if_fail( fgStructure.CurrentMenu );
+    /*
+     * If the entry is a submenu, then it needs to be wider to
+     * accomodate the arrow. JCJ 31 July 2003
+     */
+    if (menuEntry->SubMenu )
+        menuEntry->Width += glutBitmapWidth( FREEGLUT_MENU_FONT, '_' );
+}
 
-    /* The menu's box size depends on the menu entries: */
-    for( menuEntry = ( SFG_MenuEntry * )fgStructure.CurrentMenu->Entries.First;
-         menuEntry;
-         menuEntry = ( SFG_MenuEntry * )menuEntry->Node.Next )
-    {
-        /* Update the menu entry's width value */
-        menuEntry->Width = glutBitmapLength(
-            FREEGLUT_MENU_FONT,
-            (unsigned char *)menuEntry->Text
-        );
+/*
+ * Updates the current menu's box size after one entry changed width:
+ * oldWidth is -1 for an entry just added, newWidth -1 for one removed.
+ * Labels are measured once, when set, so only when the widest entry
+ * shrinks or goes away do the cached widths need looking through again.
+ */
+static void fghUpdateMenuBoxSize( int oldWidth, int newWidth )
+{
+    SFG_Menu* menu = fgStructure.CurrentMenu;
+    int i, width;
 
-        /*
-         * If the entry is a submenu, then it needs to be wider to
-         * accomodate the arrow. JCJ 31 July 2003
-         */
-        if (menuEntry->SubMenu )
-            menuEntry->Width += glutBitmapLength(
-                FREEGLUT_MENU_FONT,
-                (unsigned char *)"_"
-            );
+    /* Make sure there is a current menu set */
+    freeglut_return_if_fail( menu );
 
-        /* Check if it's the biggest we've found */
-        if( menuEntry->Width > width )
-            width = menuEntry->Width;
+    width = menu->Width - 4 * FREEGLUT_MENU_BORDER;
 
-        height += FREEGLUT_MENU_HEIGHT;
-    }
+    if( newWidth >= width )
+        width = newWidth;
+    else if( oldWidth >= width )
+        for( i = 0, width = 0; i < menu->NumEntries; i++ )
+            if( menu->Entries[ i ]->Width > width )
+                width = menu->Entries[ i ]->Width;
 
     /* Store the menu's box size now: */
-    fgStructure.CurrentMenu->Height = height + 2 * FREEGLUT_MENU_BORDER;
-    fgStructure.CurrentMenu->Width  = width  + 4 * FREEGLUT_MENU_BORDER;
+    fghLayoutMenuRows( menu, 0 );
+    menu->Width  = width + 4 * FREEGLUT_MENU_BORDER;
+
+    /* Have the cached menu body recompiled on its next display */
+    menu->BodyChanged = GL_TRUE;
+
+    /* The labels may have changed, so the type-ahead index is stale */
+    free( menu->SortedEntries );
+    menu->SortedEntries = NULL;
 }
 
 #if TARGET_HOST_MS_WINDOWS
@@ -943,9 +1508,10 @@ void FGAPIENTRY glutAddMenuEntry( const char* label, int value )
     menuEntry->ID   = value;
 
     /* Have the new menu entry attached to the current menu */
-    fgListAppend( &fgStructure.CurrentMenu->Entries, &menuEntry->Node );
+    fghAppendMenuEntry( fgStructure.CurrentMenu, menuEntry );
 
-    fghCalculateMenuBoxSize( );
+    fghMeasureMenuEntry( menuEntry );
+    fghUpdateMenuBoxSize( -1, menuEntry->Width );
 }
 
 /*
@@ -970,8 +1536,9 @@ void FGAPIENTRY glutAddSubMenu( const char *label, int subMenuID )
     menuEntry->SubMenu = subMenu;
     menuEntry->ID      = -1;
 
-    fgListAppend( &fgStructure.CurrentMenu->Entries, &menuEntry->Node );
-    fghCalculateMenuBoxSize( );
+    fghAppendMenuEntry( fgStructure.CurrentMenu, menuEntry );
+    fghMeasureMenuEntry( menuEntry );
+    fghUpdateMenuBoxSize( -1, menuEntry->Width );
 }
 
 /*
@@ -980,6 +1547,7 @@ void FGAPIENTRY glutAddSubMenu( const char *label, int subMenuID )
 void FGAPIENTRY glutChangeToMenuEntry( int item, const char* label, int value )
 {
     SFG_MenuEntry* menuEntry = NULL;
+    int width;
 
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutChangeToMenuEntry" );
 
@@ -993,13 +1561,15 @@ void FGAPIENTRY glutChangeToMenuEntry( int item, const char* label, int value )
     freeglut_return_if_fail( menuEntry );
 
     /* We want it to become a normal menu entry, so: */
+    width = menuEntry->Width;
     if( menuEntry->Text )
         free( menuEntry->Text );
 
     menuEntry->Text    = strdup( label );
     menuEntry->ID      = value;
     menuEntry->SubMenu = NULL;
-    fghCalculateMenuBoxSize( );
+    fghMeasureMenuEntry( menuEntry );
+    fghUpdateMenuBoxSize( width, menuEntry->Width );
 }
 
 /*
@@ -1010,6 +1580,7 @@ void FGAPIENTRY glutChangeToSubMenu( int item, const char* label,
 {
     SFG_Menu*      subMenu;
     SFG_MenuEntry* menuEntry;
+    int            width;
 
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutChangeToSubMenu" );
 
@@ -1029,13 +1600,15 @@ void FGAPIENTRY glutChangeToSubMenu( int item, const char* label,
     freeglut_return_if_fail( menuEntry );
 
     /* We want it to become a sub menu entry, so: */
+    width = menuEntry->Width;
     if( menuEntry->Text )
         free( menuEntry->Text );
 
     menuEntry->Text    = strdup( label );
     menuEntry->SubMenu = subMenu;
     menuEntry->ID      = -1;
-    fghCalculateMenuBoxSize( );
+    fghMeasureMenuEntry( menuEntry );
+    fghUpdateMenuBoxSize( width, menuEntry->Width );
 }
 
 /*
@@ -1044,6 +1617,7 @@ void FGAPIENTRY glutChangeToSubMenu( int item, const char* label,
 void FGAPIENTRY glutRemoveMenuItem( int item )
 {
     SFG_MenuEntry* menuEntry;
+    int width;
 
     FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutRemoveMenuItem" );
 
@@ -1056,12 +1630,13 @@ void FGAPIENTRY glutRemoveMenuItem( int item )
 
     freeglut_return_if_fail( menuEntry );
 
-    fgListRemove( &fgStructure.CurrentMenu->Entries, &menuEntry->Node );
+    width = menuEntry->Width;
+    fghRemoveMenuEntry( fgStructure.CurrentMenu, item );
     if ( menuEntry->Text )
       free( menuEntry->Text );
 
     free( menuEntry );
-    fghCalculateMenuBoxSize( );
+    fghUpdateMenuBoxSize( width, -1 );
 }
 
 /*
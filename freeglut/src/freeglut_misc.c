@@ -179,6 +179,7 @@ void FGAPIENTRY glutForceJoystickFunc( void )
 #if !defined(_WIN32_WCE)
     freeglut_return_if_fail( fgStructure.CurrentWindow != NULL );
     freeglut_return_if_fail( FETCH_WCB( *( fgStructure.CurrentWindow ), Joystick ) );
+    fgJoystickSample( );
     fgJoystickPollWindow( fgStructure.CurrentWindow );
 #endif /* !defined(_WIN32_WCE) */
 }
@@ -128,6 +128,18 @@ void FGAPIENTRY glutSetOption( GLenum eWhat, int value )
       fgState.SkipStaleMotion = value;
       break;
 
+    case GLUT_BITMAP_FONT_ATLAS:
+      fgState.BitmapFontAtlas = value ? GL_TRUE : GL_FALSE;
+      break;
+
+    case GLUT_STROKE_FONT_POINTS:
+      fgState.StrokeFontPoints = value ? GL_TRUE : GL_FALSE;
+      break;
+
+    case GLUT_MENU_MAX_ROWS:
+      fgState.MenuMaxRows = value;
+      break;
+
     default:
         fgWarning( "glutSetOption(): missing enum handle %d", eWhat );
         break;
@@ -564,7 +576,7 @@ int FGAPIENTRY glutGet( GLenum eWhat )
     case GLUT_MENU_NUM_ITEMS:
         if( fgStructure.CurrentMenu == NULL )
             return 0;
-        return fgListLength( &fgStructure.CurrentMenu->Entries );
+        return fgStructure.CurrentMenu->NumEntries;
 
     case GLUT_ACTION_ON_WINDOW_CLOSE:
         return fgState.ActionOnWindowClose;
@@ -591,6 +603,15 @@ int FGAPIENTRY glutGet( GLenum eWhat )
     case GLUT_SKIP_STALE_MOTION_EVENTS:
       return fgState.SkipStaleMotion;
 
+    case GLUT_BITMAP_FONT_ATLAS:
+      return fgState.BitmapFontAtlas;
+
+    case GLUT_STROKE_FONT_POINTS:
+      return fgState.StrokeFontPoints;
+
+    case GLUT_MENU_MAX_ROWS:
+      return fgState.MenuMaxRows;
+
     default:
         fgWarning( "glutGet(): missing enum handle %d", eWhat );
         break;
@@ -679,6 +700,9 @@ int FGAPIENTRY glutDeviceGet( GLenum eWhat )
     case GLUT_JOYSTICK_AXES:
         return glutJoystickGetNumAxes ( 0 );
 
+    case GLUT_JOYSTICK_EVENTS_COALESCED:
+        return fgJoystickEventsCoalesced ();
+
     case GLUT_HAS_DIAL_AND_BUTTON_BOX:
         return fgInputDeviceDetect ();
 
@@ -43,7 +43,11 @@ SFG_Structure fgStructure = { { NULL, NULL },  /* The list of windows       */
                               NULL,            /* The menu OpenGL context   */
                               NULL,            /* The game mode window      */
                               0,               /* The current new window ID */
-                              0 };             /* The current new menu ID   */
+                              0,               /* The current new menu ID   */
+                              NULL,            /* The menu ID hash table    */
+                              0,               /* Its number of buckets     */
+                              0,               /* The number of menus       */
+                              NULL };          /* The active top-level menu */
 
 
 /* -- PRIVATE FUNCTIONS ---------------------------------------------------- */
@@ -111,6 +115,60 @@ SFG_Window* fgCreateWindow( SFG_Window* parent, const char* title,
     return window;
 }
 
+/*
+ * Private functions keeping the menus hashed by ID.  IDs are handed out
+ * in sequence, so their low bits spread them evenly over the buckets;
+ * the table doubles when there are more menus than buckets.
+ */
+static void fghAddMenuToTable( SFG_Menu* menu )
+{
+    int bucket;
+
+    if( fgStructure.NumMenus >= fgStructure.MenuTableSize )
+    {
+        int i, size = fgStructure.MenuTableSize ?
+                      2 * fgStructure.MenuTableSize : 64;
+        SFG_Menu** table = (SFG_Menu **)calloc( size, sizeof( SFG_Menu* ) );
+
+        if( !table )
+            fgError( "Out of memory. Could not create menu table." );
+
+        for( i = 0; i < fgStructure.MenuTableSize; i++ )
+            while( fgStructure.MenuTable[ i ] )
+            {
+                SFG_Menu* moved = fgStructure.MenuTable[ i ];
+
+                fgStructure.MenuTable[ i ] = moved->HashNext;
+                moved->HashNext = table[ moved->ID & ( size - 1 ) ];
+                table[ moved->ID & ( size - 1 ) ] = moved;
+            }
+
+        free( fgStructure.MenuTable );
+        fgStructure.MenuTable = table;
+        fgStructure.MenuTableSize = size;
+    }
+
+    bucket = menu->ID & ( fgStructure.MenuTableSize - 1 );
+    menu->HashNext = fgStructure.MenuTable[ bucket ];
+    fgStructure.MenuTable[ bucket ] = menu;
+    fgStructure.NumMenus++;
+}
+
+static void fghRemoveMenuFromTable( SFG_Menu* menu )
+{
+    SFG_Menu** link =
+        &fgStructure.MenuTable[ menu->ID & ( fgStructure.MenuTableSize - 1 ) ];
+
+    while( *link && ( *link != menu ) )
+        link = &( *link )->HashNext;
+
+    if( *link )
+    {
+        *link = menu->HashNext;
+        fgStructure.NumMenus--;
+    }
+}
+
 /*
  * This private function creates a menu and adds it to the menus list
  */
@@ -138,9 +196,10 @@ SFG_Menu* fgCreateMenu( FGCBMenu menuCallback )
     menu->ID       = ++fgStructure.MenuID;
     menu->Callback = menuCallback;
     menu->ActiveEntry = NULL;
+    menu->DrawnOrdinal = -1;
 
-    fgListInit( &menu->Entries );
     fgListAppend( &fgStructure.Menus, &menu->Node );
+    fghAddMenuToTable( menu );
 
     /* Newly created menus implicitly become current ones */
     fgStructure.CurrentMenu = menu;
@@ -221,6 +280,7 @@ void fgDestroyWindow( SFG_Window* window )
       fgDeactivateMenu( window );
 
     fghClearCallBacks( window );
+    fgDestroyTextContext( window );
     fgCloseWindow( window );
     free( window );
     if( fgStructure.CurrentWindow == window )
@@ -261,13 +321,14 @@ static void fghRemoveMenuFromWindow( SFG_Window* window, SFG_Menu* menu )
  */
 static void fghRemoveMenuFromMenu( SFG_Menu* from, SFG_Menu* menu )
 {
-    SFG_MenuEntry *entry;
+    int i;
 
-    for( entry = (SFG_MenuEntry *)from->Entries.First;
-         entry;
-         entry = ( SFG_MenuEntry * )entry->Node.Next )
-        if( entry->SubMenu == menu )
-            entry->SubMenu = NULL;
+    for( i = 0; i < from->NumEntries; i++ )
+        if( from->Entries[ i ]->SubMenu == menu )
+        {
+            from->Entries[ i ]->SubMenu = NULL;
+            from->BodyChanged = GL_TRUE;
+        }
 }
 
 /*
@@ -310,11 +371,9 @@ void fgDestroyMenu( SFG_Menu* menu )
      * Now we are pretty sure the menu is not used anywhere
      * and that we can remove all of its entries
      */
-    while( menu->Entries.First )
+    while( menu->NumEntries )
     {
-        SFG_MenuEntry *entry = ( SFG_MenuEntry * ) menu->Entries.First;
-
-        fgListRemove( &menu->Entries, &entry->Node );
+        SFG_MenuEntry *entry = menu->Entries[ --menu->NumEntries ];
 
         if( entry->Text )
             free( entry->Text );
@@ -322,11 +381,18 @@ void fgDestroyMenu( SFG_Menu* menu )
 
         free( entry );
     }
+    free( menu->Entries );
+    menu->Entries = NULL;
+    free( menu->SortedEntries );
+    menu->SortedEntries = NULL;
 
     if( fgStructure.CurrentWindow == menu->Window )
         fgSetWindow( NULL );
     fgDestroyWindow( menu->Window );
     fgListRemove( &fgStructure.Menus, &menu->Node );
+    fghRemoveMenuFromTable( menu );
+    if( fgStructure.ActiveMenu == menu )
+        fgStructure.ActiveMenu = NULL;
     if( fgStructure.CurrentMenu == menu )
         fgStructure.CurrentMenu = NULL;
 
@@ -357,6 +423,10 @@ void fgCreateStructure( void )
     fgStructure.GameModeWindow = NULL;
     fgStructure.WindowID = 0;
     fgStructure.MenuID = 0;
+    fgStructure.MenuTable = NULL;
+    fgStructure.MenuTableSize = 0;
+    fgStructure.NumMenus = 0;
+    fgStructure.ActiveMenu = NULL;
 }
 
 /*
@@ -375,6 +445,10 @@ void fgDestroyStructure( void )
 
     while( fgStructure.Windows.First )
         fgDestroyWindow( ( SFG_Window * )fgStructure.Windows.First );
+
+    free( fgStructure.MenuTable );
+    fgStructure.MenuTable = NULL;
+    fgStructure.MenuTableSize = 0;
 }
 
 /*
@@ -527,77 +601,31 @@ SFG_Window* fgWindowByID( int windowID )
 }
 
 /*
- * Looks up a menu given its ID. This is easier that fgWindowByXXX
- * A static helper function to look for a menu given its ID
+ * Looks up a menu given its ID, in the hash table the menus are kept in
  */
-static void fghcbMenuByID( SFG_Menu *menu, SFG_Enumerator *enumerator )
+SFG_Menu* fgMenuByID( int menuID )
 {
-    if ( enumerator->found )
-        return;
+    SFG_Menu *menu;
 
-    /* Check the menu's ID. */
-    if( menu->ID == (int)(enumerator->data) )
-    {
-        enumerator->found = GL_TRUE;
-        enumerator->data = menu;
-        
-        return;
-    }
-}
+    if( !fgStructure.MenuTableSize )
+        return NULL;
 
-/*
- * Looks up a menu given its ID. This is easier than fgWindowByXXX
- * as all menus are placed in one doubly linked list...
- */
-SFG_Menu* fgMenuByID( int menuID )
-{
-    SFG_Enumerator enumerator;
+    for( menu = fgStructure.MenuTable[ menuID & ( fgStructure.MenuTableSize - 1 ) ];
+         menu;
+         menu = menu->HashNext )
+        if( menu->ID == menuID )
+            return menu;
 
-    /* This is easy and makes use of the menus enumeration defined above */
-    enumerator.found = GL_FALSE;
-    enumerator.data = (void *)menuID;
-    fgEnumMenus( fghcbMenuByID, &enumerator );
-    
-    if( enumerator.found )
-        return( SFG_Menu *) enumerator.data;
-    
     return NULL;
 }
 
-/*
- * A static helper function to look for an active menu
- */
-static void fghcbGetActiveMenu( SFG_Menu *menu, SFG_Enumerator *enumerator )
-{
-    if ( enumerator->found )
-        return;
-    
-    /* Check the menu's ID. */
-    if( menu->IsActive )
-    {
-        enumerator->found = GL_TRUE;
-        enumerator->data = menu;
-        
-        return;
-    }
-}
-
 /*
  * Returns active menu, if any. Assumption: only one menu active throughout application at any one time.
- * This is easier than fgWindowByXXX as all menus are placed in one doubly linked list...
+ * fghActivateMenu() and fgDeactivateMenu() keep track of it.
  */
 SFG_Menu* fgGetActiveMenu( )
 {
-    SFG_Enumerator enumerator;
-    
-    /* This is easy and makes use of the menus enumeration defined above */
-    enumerator.found = GL_FALSE;
-    fgEnumMenus( fghcbGetActiveMenu, &enumerator );
-    
-    if( enumerator.found )
-        return( SFG_Menu *) enumerator.data;
-    
-    return NULL;
+    return fgStructure.ActiveMenu;
 }
 
 /*
@@ -78,21 +78,228 @@
 
 /* -- PRIVATE FUNCTIONS ---------------------------------------------------- */
 
+#if !defined(_WIN32_WCE)
+/*
+ * The ten Bezier patches are tessellated on the CPU once per grid size
+ * and cached as an indexed mesh, instead of going through glMap2d() and
+ * glEvalMesh2() on every call. Evaluators are a slow software path with
+ * most drivers.
+ *
+ * The rim, body, lid and bottom are reflected in x and y, giving four
+ * surfaces each; the handle and spout are reflected in y only.
+ */
+#define  FGH_TEAPOT_SURFACES  ( 6 * 4 + 4 * 2 )
+
+/*
+ * Cubic Bernstein basis and its derivative at t
+ */
+static void fghTeapotBasis( double t, double b[4], double db[4] )
+{
+    const double s = 1.0 - t;
+
+    b[0] = s * s * s;
+    b[1] = 3.0 * t * s * s;
+    b[2] = 3.0 * t * t * s;
+    b[3] = t * t * t;
+
+    db[0] = -3.0 * s * s;
+    db[1] =  3.0 * s * s - 6.0 * t * s;
+    db[2] =  6.0 * t * s - 3.0 * t * t;
+    db[3] =  3.0 * t * t;
+}
+
+/*
+ * Evaluates the position and both partial derivatives of a bicubic
+ * patch, given the basis in u (the inner control point index) and v.
+ */
+static void fghTeapotEvaluate( double cp[4][4][3],
+                               const double bu[4], const double dbu[4],
+                               const double bv[4], const double dbv[4],
+                               double pos[3], double du[3], double dv[3] )
+{
+    int j, k, l;
+
+    for( l = 0; l < 3; l++ )
+        pos[l] = du[l] = dv[l] = 0.0;
+
+    for( j = 0; j < 4; j++ )
+        for( k = 0; k < 4; k++ )
+        {
+            const double w  = bv[j]  * bu[k];
+            const double wu = bv[j]  * dbu[k];
+            const double wv = dbv[j] * bu[k];
+
+            for( l = 0; l < 3; l++ )
+            {
+                pos[l] += w  * cp[j][k][l];
+                du[l]  += wu * cp[j][k][l];
+                dv[l]  += wv * cp[j][k][l];
+            }
+        }
+}
+
+/*
+ * Tessellates one surface into a (grid+1)x(grid+1) block of vertices
+ * starting at vertex "base", matching what glEvalMesh2() produced with
+ * GL_AUTO_NORMAL: the normal is dP/du x dP/dv. Where the patch
+ * collapses to a point (lid top, bottom centre) that cross product
+ * vanishes, so it is taken just inside the patch instead.
+ */
+static void fghTeapotSurface( SFG_Mesh* mesh, int base, double cp[4][4][3],
+                              GLint grid, double (*basis)[4], double (*dbasis)[4] )
+{
+    const int n = grid + 1;
+    int i, j;
+
+    for( j = 0; j < n; j++ )
+        for( i = 0; i < n; i++ )
+        {
+            const int v = base + j * n + i;
+            double pos[3], du[3], dv[3], nrm[3], len;
+            const double u = ( double )i / grid, w = ( double )j / grid;
+
+            fghTeapotEvaluate( cp, basis[i], dbasis[i], basis[j], dbasis[j],
+                               pos, du, dv );
+
+            nrm[0] = du[1] * dv[2] - du[2] * dv[1];
+            nrm[1] = du[2] * dv[0] - du[0] * dv[2];
+            nrm[2] = du[0] * dv[1] - du[1] * dv[0];
+            len = sqrt( nrm[0] * nrm[0] + nrm[1] * nrm[1] + nrm[2] * nrm[2] );
+
+            if( len < 1.0e-10 )
+            {
+                double bu[4], dbu[4], bv[4], dbv[4], tmp[3];
+                const double eps = 1.0e-3;
+
+                fghTeapotBasis( ( u < eps ) ? eps : ( u > 1.0 - eps ) ? 1.0 - eps : u, bu, dbu );
+                fghTeapotBasis( ( w < eps ) ? eps : ( w > 1.0 - eps ) ? 1.0 - eps : w, bv, dbv );
+                fghTeapotEvaluate( cp, bu, dbu, bv, dbv, tmp, du, dv );
+
+                nrm[0] = du[1] * dv[2] - du[2] * dv[1];
+                nrm[1] = du[2] * dv[0] - du[0] * dv[2];
+                nrm[2] = du[0] * dv[1] - du[1] * dv[0];
+                len = sqrt( nrm[0] * nrm[0] + nrm[1] * nrm[1] + nrm[2] * nrm[2] );
+                if( len < 1.0e-10 )
+                    len = 1.0;
+            }
+
+            mesh->Vertices[ 3 * v + 0 ] = ( GLfloat )pos[0];
+            mesh->Vertices[ 3 * v + 1 ] = ( GLfloat )pos[1];
+            mesh->Vertices[ 3 * v + 2 ] = ( GLfloat )pos[2];
+            mesh->Normals [ 3 * v + 0 ] = ( GLfloat )( nrm[0] / len );
+            mesh->Normals [ 3 * v + 1 ] = ( GLfloat )( nrm[1] / len );
+            mesh->Normals [ 3 * v + 2 ] = ( GLfloat )( nrm[2] / len );
+
+            /* Bilinear, like the old GL_MAP2_TEXTURE_COORD_2 evaluator */
+            mesh->TexCoords[ 2 * v + 0 ] = ( GLfloat )(
+                ( 1.0 - w ) * ( ( 1.0 - u ) * tex[0][0][0] + u * tex[0][1][0] ) +
+                        w   * ( ( 1.0 - u ) * tex[1][0][0] + u * tex[1][1][0] ) );
+            mesh->TexCoords[ 2 * v + 1 ] = ( GLfloat )(
+                ( 1.0 - w ) * ( ( 1.0 - u ) * tex[0][0][1] + u * tex[0][1][1] ) +
+                        w   * ( ( 1.0 - u ) * tex[1][0][1] + u * tex[1][1][1] ) );
+        }
+}
+
+/*
+ * Returns the teapot mesh for the given grid size, building it on first use
+ */
+static SFG_Mesh* fghTeapotMesh( GLint grid )
+{
+    const GLdouble key = grid;
+    const int n = grid + 1;
+    double (*basis)[4], (*dbasis)[4];
+    double cp[4][4][3];
+    GLuint *idx, *lidx;
+    int i, j, k, l, s, surface = 0;
+    SFG_Mesh* mesh = fgFindMesh( FG_MESH_TEAPOT, &key, 1 );
+
+    if( mesh )
+        return mesh;
+
+    mesh = fgCreateMesh( FG_MESH_TEAPOT, &key, 1,
+                         FGH_TEAPOT_SURFACES * n * n, GL_TRUE );
+    mesh->NumIndices = FGH_TEAPOT_SURFACES * 6 * grid * grid;
+    mesh->Indices = ( GLuint * )malloc( mesh->NumIndices * sizeof( GLuint ) );
+    mesh->NumLineIndices = FGH_TEAPOT_SURFACES * 4 * grid * n;
+    mesh->LineIndices = ( GLuint * )malloc( mesh->NumLineIndices * sizeof( GLuint ) );
+
+    /* The basis only depends on the grid, so evaluate it once per row */
+    basis  = ( double (*)[4] )malloc( n * sizeof( *basis ) );
+    dbasis = ( double (*)[4] )malloc( n * sizeof( *dbasis ) );
+
+    if( !mesh->Indices || !mesh->LineIndices || !basis || !dbasis )
+        fgError( "Failed to allocate memory in fghTeapotMesh" );
+
+    for( i = 0; i < n; i++ )
+        fghTeapotBasis( ( double )i / grid, basis[i], dbasis[i] );
+
+    idx  = mesh->Indices;
+    lidx = mesh->LineIndices;
+
+    for( i = 0; i < 10; i++ )
+        for( s = 0; s < ( ( i < 6 ) ? 4 : 2 ); s++, surface++ )
+        {
+            const GLuint base = surface * n * n;
+
+            /*
+             * s == 0 is the patch as given, s == 1 is reflected in y,
+             * s == 2 in x and s == 3 in both. The single reflections
+             * also reverse the u direction to keep the normals outwards.
+             */
+            for( j = 0; j < 4; j++ )
+                for( k = 0; k < 4; k++ )
+                {
+                    const int kk = ( s == 1 || s == 2 ) ? 3 - k : k;
+
+                    for( l = 0; l < 3; l++ )
+                        cp[j][k][l] = cpdata[ patchdata[i][j * 4 + kk] ][l];
+
+                    if( s == 2 || s == 3 )
+                        cp[j][k][0] *= -1.0;
+                    if( s == 1 || s == 3 )
+                        cp[j][k][1] *= -1.0;
+                }
+
+            fghTeapotSurface( mesh, base, cp, grid, basis, dbasis );
+
+            /* Same triangles and winding as glEvalMesh2()'s quad strips */
+            for( j = 0; j < grid; j++ )
+                for( k = 0; k < grid; k++ )
+                {
+                    const GLuint a = base + j * n + k;
+
+                    *idx++ = a;     *idx++ = a + n; *idx++ = a + 1;
+                    *idx++ = a + 1; *idx++ = a + n; *idx++ = a + n + 1;
+                }
+
+            /* Grid lines in both directions, as glEvalMesh2( GL_LINE ) */
+            for( j = 0; j < n; j++ )
+                for( k = 0; k < grid; k++ )
+                {
+                    *lidx++ = base + j * n + k;
+                    *lidx++ = base + j * n + k + 1;
+                    *lidx++ = base + k * n + j;
+                    *lidx++ = base + ( k + 1 ) * n + j;
+                }
+        }
+
+    free( basis );
+    free( dbasis );
+
+    fgOptimizeMesh( mesh );
+
+    return mesh;
+}
+#endif  /* !defined(_WIN32_WCE) */
 
 static void fghTeapot( GLint grid, GLdouble scale, GLenum type )
 {
 #if defined(_WIN32_WCE)
 		int i, numV=sizeof(strip_vertices)/4, numI=sizeof(strip_normals)/4;
-#else
-    double p[4][4][3], q[4][4][3], r[4][4][3], s[4][4][3];
-    long i, j, k, l;
 #endif
 
-    glPushAttrib( GL_ENABLE_BIT | GL_EVAL_BIT );
-    glEnable( GL_AUTO_NORMAL );
+    glPushAttrib( GL_ENABLE_BIT );
     glEnable( GL_NORMALIZE );
-    glEnable( GL_MAP2_VERTEX_3 );
-    glEnable( GL_MAP2_TEXTURE_COORD_2 );
 
     glPushMatrix();
     glRotated( 270.0, 1.0, 0.0, 0.0 );
@@ -100,6 +307,7 @@ static void fghTeapot( GLint grid, GLdouble scale, GLenum type )
     glTranslated( 0.0, 0.0, -1.5 );
 
 #if defined(_WIN32_WCE)
+    /* The fixed triangle strip data is used whatever the grid */
     glRotated( 90.0, 1.0, 0.0, 0.0 );
     glBegin( GL_TRIANGLE_STRIP );
 
@@ -122,47 +330,7 @@ static void fghTeapot( GLint grid, GLdouble scale, GLenum type )
 
     glEnd();
 #else
-    for (i = 0; i < 10; i++) {
-      for (j = 0; j < 4; j++) {
-        for (k = 0; k < 4; k++) {
-          for (l = 0; l < 3; l++) {
-            p[j][k][l] = cpdata[patchdata[i][j * 4 + k]][l];
-            q[j][k][l] = cpdata[patchdata[i][j * 4 + (3 - k)]][l];
-            if (l == 1)
-              q[j][k][l] *= -1.0;
-            if (i < 6) {
-              r[j][k][l] =
-                cpdata[patchdata[i][j * 4 + (3 - k)]][l];
-              if (l == 0)
-                r[j][k][l] *= -1.0;
-              s[j][k][l] = cpdata[patchdata[i][j * 4 + k]][l];
-              if (l == 0)
-                s[j][k][l] *= -1.0;
-              if (l == 1)
-                s[j][k][l] *= -1.0;
-            }
-          }
-        }
-      }
-
-      glMap2d(GL_MAP2_TEXTURE_COORD_2, 0.0, 1.0, 2, 2, 0.0, 1.0, 4, 2,
-        &tex[0][0][0]);
-      glMap2d(GL_MAP2_VERTEX_3, 0.0, 1.0, 3, 4, 0.0, 1.0, 12, 4,
-        &p[0][0][0]);
-      glMapGrid2d(grid, 0.0, 1.0, grid, 0.0, 1.0);
-      glEvalMesh2(type, 0, grid, 0, grid);
-      glMap2d(GL_MAP2_VERTEX_3, 0.0, 1.0, 3, 4, 0.0, 1.0, 12, 4,
-        &q[0][0][0]);
-      glEvalMesh2(type, 0, grid, 0, grid);
-      if (i < 6) {
-        glMap2d(GL_MAP2_VERTEX_3, 0.0, 1.0, 3, 4, 0.0, 1.0, 12, 4,
-          &r[0][0][0]);
-        glEvalMesh2(type, 0, grid, 0, grid);
-        glMap2d(GL_MAP2_VERTEX_3, 0.0, 1.0, 3, 4, 0.0, 1.0, 12, 4,
-          &s[0][0][0]);
-        glEvalMesh2(type, 0, grid, 0, grid);
-      }
-    }
+    fgDrawMesh( fghTeapotMesh( grid ), ( type == GL_LINE ) ? GL_TRUE : GL_FALSE );
 #endif  /* defined(_WIN32_WCE) */
 
     glPopMatrix();
@@ -192,6 +360,22 @@ void FGAPIENTRY glutSolidTeapot( GLdouble size )
     fghTeapot( 7, size, GL_FILL );
 }
 
+/*
+ * Same as above, but with the number of grid subdivisions
+ * per Bezier patch given as a level of detail hint
+ */
+void FGAPIENTRY glutWireTeapotLOD( GLdouble size, GLint grid )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutWireTeapotLOD" );
+    fghTeapot( ( grid > 0 ) ? grid : 1, size, GL_LINE );
+}
+
+void FGAPIENTRY glutSolidTeapotLOD( GLdouble size, GLint grid )
+{
+    FREEGLUT_EXIT_IF_NOT_INITIALISED ( "glutSolidTeapotLOD" );
+    fghTeapot( ( grid > 0 ) ? grid : 1, size, GL_FILL );
+}
+
 /*** END OF FILE ***/
 
 